@@ -0,0 +1,23 @@
+/*
+ * Half-width digit font for the sliding puzzle game
+ *
+ * Digits 0-9, 3x5 pixels each. One byte per row with the glyph in
+ * bits 7-5 (bit 7 = leftmost pixel). Two-digit number tiles are
+ * composed from these at startup.
+ */
+
+#include <gb/gb.h>
+#include <stdint.h>
+
+const uint8_t digit_font[10][5] = {
+    { 0xE0, 0xA0, 0xA0, 0xA0, 0xE0 },  /* 0 */
+    { 0x40, 0xC0, 0x40, 0x40, 0xE0 },  /* 1 */
+    { 0xE0, 0x20, 0xE0, 0x80, 0xE0 },  /* 2 */
+    { 0xE0, 0x20, 0x60, 0x20, 0xE0 },  /* 3 */
+    { 0xA0, 0xA0, 0xE0, 0x20, 0x20 },  /* 4 */
+    { 0xE0, 0x80, 0xE0, 0x20, 0xE0 },  /* 5 */
+    { 0xE0, 0x80, 0xE0, 0xA0, 0xE0 },  /* 6 */
+    { 0xE0, 0x20, 0x40, 0x40, 0x40 },  /* 7 */
+    { 0xE0, 0xA0, 0xE0, 0xA0, 0xE0 },  /* 8 */
+    { 0xE0, 0xA0, 0xE0, 0x20, 0xE0 },  /* 9 */
+};
@@ -0,0 +1,19 @@
+/*
+ * Sprite tile data for the sliding puzzle game (Game Boy Color)
+ *
+ * Each tile is 8x8 pixels, 2bpp format (16 bytes per tile).
+ * Color 0 is transparent for sprites.
+ * Tile indices:
+ *   0  = cursor corner bracket (top-left; the other corners are
+ *        the same tile flipped through the OAM attributes)
+ */
+
+#include <gb/gb.h>
+
+const unsigned char sprite_tiles[] = {
+    /* Tile 0: Cursor corner bracket (color 2) */
+    0x00, 0xFC, 0x00, 0xFC, 0x00, 0xC0, 0x00, 0xC0,
+    0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
+};
+
+const uint8_t SPRITE_TILES_COUNT = 1;
@@ -1,187 +1,27 @@
 /*
- * Tile data for the sliding puzzle game (Game Boy Color)
+ * Compressed tile set
  *
- * Each tile is 8x8 pixels, 2bpp format (16 bytes per tile).
- * Tile indices:
- *   0  = blank/empty tile
- *   1  = border top-left
- *   2  = border top
- *   3  = border top-right
- *   4  = border left
- *   5  = border right
- *   6  = border bottom-left
- *   7  = border bottom
- *   8  = border bottom-right
- *   9  = empty puzzle cell background
- *   10-25 = number tiles 1-15 (+ empty cell marker)
- *   26 = cursor/highlight tile
+ * Generated by tools/png2tiles.py from res/tiles.png - do not edit.
+ * 29 tiles: 464 bytes as 2bpp, 356 packed, 156 compressed.
  */
 
 #include <gb/gb.h>
-
-/* Number font data - each digit as 8x8 tile, used to compose number tiles */
-/* These are pre-rendered number tiles for 1-15 and empty */
-
-const unsigned char puzzle_tiles[] = {
-    /* Tile 0: Fully blank */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-
-    /* Tile 1: Border top-left corner */
-    0xFF, 0xFF, 0x80, 0xFF, 0x80, 0xBF, 0x80, 0xBF,
-    0x80, 0xBF, 0x80, 0xBF, 0x80, 0xBF, 0x80, 0xBF,
-
-    /* Tile 2: Border top */
-    0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-
-    /* Tile 3: Border top-right corner */
-    0xFF, 0xFF, 0x01, 0xFF, 0x01, 0xFD, 0x01, 0xFD,
-    0x01, 0xFD, 0x01, 0xFD, 0x01, 0xFD, 0x01, 0xFD,
-
-    /* Tile 4: Border left */
-    0x80, 0xBF, 0x80, 0xBF, 0x80, 0xBF, 0x80, 0xBF,
-    0x80, 0xBF, 0x80, 0xBF, 0x80, 0xBF, 0x80, 0xBF,
-
-    /* Tile 5: Border right */
-    0x01, 0xFD, 0x01, 0xFD, 0x01, 0xFD, 0x01, 0xFD,
-    0x01, 0xFD, 0x01, 0xFD, 0x01, 0xFD, 0x01, 0xFD,
-
-    /* Tile 6: Border bottom-left corner */
-    0x80, 0xBF, 0x80, 0xBF, 0x80, 0xBF, 0x80, 0xBF,
-    0x80, 0xBF, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-
-    /* Tile 7: Border bottom */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-
-    /* Tile 8: Border bottom-right corner */
-    0x01, 0xFD, 0x01, 0xFD, 0x01, 0xFD, 0x01, 0xFD,
-    0x01, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-
-    /* Tile 9: Cell background (light fill) */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-
-    /* Tile 10: Number "1" */
-    0x00, 0x00, 0x18, 0x18, 0x38, 0x38, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x3C, 0x3C, 0x00, 0x00,
-
-    /* Tile 11: Number "2" */
-    0x00, 0x00, 0x3C, 0x3C, 0x66, 0x66, 0x06, 0x06,
-    0x1C, 0x1C, 0x30, 0x30, 0x7E, 0x7E, 0x00, 0x00,
-
-    /* Tile 12: Number "3" */
-    0x00, 0x00, 0x3C, 0x3C, 0x66, 0x66, 0x1C, 0x1C,
-    0x06, 0x06, 0x66, 0x66, 0x3C, 0x3C, 0x00, 0x00,
-
-    /* Tile 13: Number "4" */
-    0x00, 0x00, 0x0C, 0x0C, 0x1C, 0x1C, 0x2C, 0x2C,
-    0x4C, 0x4C, 0x7E, 0x7E, 0x0C, 0x0C, 0x00, 0x00,
-
-    /* Tile 14: Number "5" */
-    0x00, 0x00, 0x7E, 0x7E, 0x60, 0x60, 0x7C, 0x7C,
-    0x06, 0x06, 0x46, 0x46, 0x3C, 0x3C, 0x00, 0x00,
-
-    /* Tile 15: Number "6" */
-    0x00, 0x00, 0x1C, 0x1C, 0x30, 0x30, 0x7C, 0x7C,
-    0x66, 0x66, 0x66, 0x66, 0x3C, 0x3C, 0x00, 0x00,
-
-    /* Tile 16: Number "7" */
-    0x00, 0x00, 0x7E, 0x7E, 0x06, 0x06, 0x0C, 0x0C,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00,
-
-    /* Tile 17: Number "8" */
-    0x00, 0x00, 0x3C, 0x3C, 0x66, 0x66, 0x3C, 0x3C,
-    0x66, 0x66, 0x66, 0x66, 0x3C, 0x3C, 0x00, 0x00,
-
-    /* Tile 18: Number "9" */
-    0x00, 0x00, 0x3C, 0x3C, 0x66, 0x66, 0x66, 0x66,
-    0x3E, 0x3E, 0x0C, 0x0C, 0x38, 0x38, 0x00, 0x00,
-
-    /* Tile 19: Number "10" - "1" left half */
-    0x00, 0x00, 0x08, 0x08, 0x18, 0x18, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x1C, 0x1C, 0x00, 0x00,
-
-    /* Tile 20: Number "10" - "0" right half */
-    0x00, 0x00, 0x3C, 0x3C, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x3C, 0x3C, 0x00, 0x00,
-
-    /* Tile 21: Number "11" - "1" left */
-    0x00, 0x00, 0x08, 0x08, 0x18, 0x18, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x1C, 0x1C, 0x00, 0x00,
-
-    /* Tile 22: Number "11" - "1" right */
-    0x00, 0x00, 0x08, 0x08, 0x18, 0x18, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x1C, 0x1C, 0x00, 0x00,
-
-    /* Tile 23: Number "12" - "1" left */
-    0x00, 0x00, 0x08, 0x08, 0x18, 0x18, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x1C, 0x1C, 0x00, 0x00,
-
-    /* Tile 24: Number "12" - "2" right */
-    0x00, 0x00, 0x3C, 0x3C, 0x66, 0x66, 0x06, 0x06,
-    0x1C, 0x1C, 0x30, 0x30, 0x7E, 0x7E, 0x00, 0x00,
-
-    /* Tile 25: Number "13" - "1" left */
-    0x00, 0x00, 0x08, 0x08, 0x18, 0x18, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x1C, 0x1C, 0x00, 0x00,
-
-    /* Tile 26: Number "13" - "3" right */
-    0x00, 0x00, 0x3C, 0x3C, 0x66, 0x66, 0x1C, 0x1C,
-    0x06, 0x06, 0x66, 0x66, 0x3C, 0x3C, 0x00, 0x00,
-
-    /* Tile 27: Number "14" - "1" left */
-    0x00, 0x00, 0x08, 0x08, 0x18, 0x18, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x1C, 0x1C, 0x00, 0x00,
-
-    /* Tile 28: Number "14" - "4" right */
-    0x00, 0x00, 0x0C, 0x0C, 0x1C, 0x1C, 0x2C, 0x2C,
-    0x4C, 0x4C, 0x7E, 0x7E, 0x0C, 0x0C, 0x00, 0x00,
-
-    /* Tile 29: Number "15" - "1" left */
-    0x00, 0x00, 0x08, 0x08, 0x18, 0x18, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x1C, 0x1C, 0x00, 0x00,
-
-    /* Tile 30: Number "15" - "5" right */
-    0x00, 0x00, 0x7E, 0x7E, 0x60, 0x60, 0x7C, 0x7C,
-    0x06, 0x06, 0x46, 0x46, 0x3C, 0x3C, 0x00, 0x00,
-
-    /* Tile 31: Empty cell (dark) */
-    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-
-    /* Tile 32: Tile top-left corner */
-    0xFF, 0xFF, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0,
-    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
-
-    /* Tile 33: Tile top edge */
-    0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-
-    /* Tile 34: Tile top-right corner */
-    0xFF, 0xFF, 0x03, 0xFF, 0x03, 0x03, 0x03, 0x03,
-    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
-
-    /* Tile 35: Tile left edge */
-    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
-    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
-
-    /* Tile 36: Tile right edge */
-    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
-    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
-
-    /* Tile 37: Tile bottom-left corner */
-    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
-    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF,
-
-    /* Tile 38: Tile bottom edge */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-
-    /* Tile 39: Tile bottom-right corner */
-    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
-    0x03, 0x03, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF,
+#include <stdint.h>
+
+const uint8_t puzzle_tiles[] = {
+    0x01, 0x81, 0x86, 0x00, 0x07, 0x08, 0xFF, 0xFF, 0x80, 0xFF, 0x80, 0xBF,
+    0xC7, 0x01, 0x04, 0xFF, 0xFF, 0x00, 0xFF, 0x89, 0x00, 0x06, 0xFF, 0xFF,
+    0x01, 0xFF, 0x01, 0xFD, 0xC7, 0x01, 0xC9, 0x2B, 0xC1, 0x37, 0xC9, 0x1B,
+    0xCC, 0x1F, 0x80, 0xFF, 0x8A, 0x00, 0xC2, 0x0F, 0xC8, 0x4B, 0xC2, 0x1F,
+    0x02, 0x8B, 0x30, 0x86, 0x00, 0x02, 0x18, 0x38, 0x80, 0x18, 0x09, 0x3C,
+    0x00, 0x00, 0x3C, 0x66, 0x06, 0x1C, 0x30, 0x7E, 0xC1, 0x07, 0x03, 0x1C,
+    0x06, 0x66, 0xC0, 0x0F, 0x0D, 0x0C, 0x1C, 0x2C, 0x4C, 0x7E, 0x0C, 0x00,
+    0x00, 0x7E, 0x60, 0x7C, 0x06, 0x46, 0xC0, 0x1F, 0x04, 0x1C, 0x30, 0x7C,
+    0x66, 0xC1, 0x17, 0x03, 0x7E, 0x06, 0x0C, 0x80, 0x18, 0xC1, 0x2F, 0x01,
+    0x3C, 0xC2, 0x0F, 0xC0, 0x05, 0x03, 0x3E, 0x0C, 0x38, 0xC2, 0x07, 0xC1,
+    0x1F, 0x02, 0x81, 0x11, 0x85, 0x00, 0x05, 0x03, 0xFF, 0xFF, 0xC0, 0xFF,
+    0x89, 0xC0, 0xCF, 0xE4, 0x02, 0x03, 0xFF, 0x89, 0x03, 0x02, 0x82, 0x30,
+    0x85, 0xC0, 0x86, 0x03, 0x8A, 0xC0, 0xD0, 0xD9, 0x8A, 0x03, 0xC1, 0xF9,
 };
 
-const uint8_t PUZZLE_TILES_COUNT = 40;
+const uint8_t PUZZLE_TILES_COUNT = 29;
@@ -0,0 +1,39 @@
+/*
+ * CGB tile set, deduplicated under X/Y flip
+ *
+ * Generated by tools/dedup_tiles.py from res/tiles.c - do not edit.
+ * 29 logical tiles, 18 unique tiles in VRAM, 119 bytes compressed.
+ * VRAM: bank 0 tiles 0-17.
+ */
+
+#include <gb/gb.h>
+#include <stdint.h>
+
+const uint8_t puzzle_tiles_cgb[] = {
+    0x04, 0x80, 0x00, 0x00, 0x81, 0x86, 0x00, 0x07, 0x05, 0xFF, 0xFF, 0x80,
+    0xFF, 0x80, 0xBF, 0xC7, 0x01, 0x04, 0xFF, 0xFF, 0x00, 0xFF, 0x89, 0x00,
+    0xC9, 0x1B, 0xCC, 0x0B, 0x80, 0xFF, 0x8A, 0x00, 0xC2, 0x0F, 0x05, 0x89,
+    0x30, 0x00, 0x18, 0x38, 0x80, 0x18, 0x09, 0x3C, 0x00, 0x00, 0x3C, 0x66,
+    0x06, 0x1C, 0x30, 0x7E, 0xC1, 0x07, 0x03, 0x1C, 0x06, 0x66, 0xC0, 0x0F,
+    0x0D, 0x0C, 0x1C, 0x2C, 0x4C, 0x7E, 0x0C, 0x00, 0x00, 0x7E, 0x60, 0x7C,
+    0x06, 0x46, 0xC0, 0x1F, 0x04, 0x1C, 0x30, 0x7C, 0x66, 0xC1, 0x17, 0x03,
+    0x7E, 0x06, 0x0C, 0x80, 0x18, 0xC1, 0x2F, 0x01, 0x3C, 0xC2, 0x0F, 0xC0,
+    0x05, 0xC1, 0x17, 0x02, 0x81, 0x11, 0x85, 0x00, 0x05, 0x01, 0xFF, 0xFF,
+    0xC0, 0xFF, 0x89, 0xC0, 0x02, 0x81, 0x30, 0x85, 0xC0, 0x01, 0x00,
+};
+
+const uint8_t PUZZLE_TILES_CGB_COUNT = 18;
+
+/* Logical tile -> CGB VRAM tile */
+const uint8_t puzzle_tile_ids[29] = {
+     0,  1,  2,  1,  3,  3,  4,  5,  4,  0,
+     6,  7,  8,  9, 10, 11, 12, 13, 11, 14,
+    15, 16,  2, 16, 17, 17, 16,  2, 16,
+};
+
+/* Logical tile -> BG attribute bits (0x20 X flip, 0x40 Y flip, 0x08 bank 1) */
+const uint8_t puzzle_tile_attrs[29] = {
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x40, 0x40, 0x60,
+};
@@ -0,0 +1,29 @@
+/*
+ * Compressed tile set
+ *
+ * Generated by tools/png2tiles.py from res/tiles_round.png - do not edit.
+ * 29 tiles: 464 bytes as 2bpp, 356 packed, 176 compressed.
+ */
+
+#include <gb/gb.h>
+#include <stdint.h>
+
+const uint8_t round_tiles[] = {
+    0x01, 0x81, 0x86, 0x00, 0x07, 0x08, 0x3F, 0x3F, 0x40, 0x7F, 0x80, 0xBF,
+    0xC7, 0x01, 0x04, 0xFF, 0xFF, 0x00, 0xFF, 0x89, 0x00, 0x06, 0xFC, 0xFC,
+    0x02, 0xFE, 0x01, 0xFD, 0xC7, 0x01, 0xC9, 0x2B, 0xC1, 0x37, 0xC9, 0x1B,
+    0xCB, 0x1F, 0x04, 0x40, 0x7F, 0x3F, 0x3F, 0x8A, 0x00, 0x80, 0xFF, 0x02,
+    0x00, 0x00, 0xC7, 0x4B, 0x08, 0x02, 0xFE, 0xFC, 0xFC, 0x00, 0x00, 0x8B,
+    0x30, 0x86, 0x00, 0x02, 0x18, 0x38, 0x80, 0x18, 0x09, 0x3C, 0x00, 0x00,
+    0x3C, 0x66, 0x06, 0x1C, 0x30, 0x7E, 0xC1, 0x07, 0x03, 0x1C, 0x06, 0x66,
+    0xC0, 0x0F, 0x0D, 0x0C, 0x1C, 0x2C, 0x4C, 0x7E, 0x0C, 0x00, 0x00, 0x7E,
+    0x60, 0x7C, 0x06, 0x46, 0xC0, 0x1F, 0x04, 0x1C, 0x30, 0x7C, 0x66, 0xC1,
+    0x17, 0x03, 0x7E, 0x06, 0x0C, 0x80, 0x18, 0xC1, 0x2F, 0x01, 0x3C, 0xC2,
+    0x0F, 0xC0, 0x05, 0x03, 0x3E, 0x0C, 0x38, 0xC2, 0x07, 0xC1, 0x1F, 0x02,
+    0x81, 0x11, 0x85, 0x00, 0x07, 0x03, 0x3F, 0x3F, 0x60, 0x7F, 0xC0, 0xE0,
+    0x87, 0xC0, 0xCF, 0xE4, 0x04, 0x06, 0xFE, 0x03, 0x07, 0x87, 0x03, 0x02,
+    0x82, 0x30, 0x85, 0xC0, 0x86, 0x03, 0x88, 0xC0, 0x02, 0xE0, 0x60, 0xD0,
+    0xD9, 0x88, 0x03, 0x02, 0x07, 0x06, 0xC1, 0xD9,
+};
+
+const uint8_t ROUND_TILES_COUNT = 29;
@@ -0,0 +1,40 @@
+/*
+ * CGB tile set, deduplicated under X/Y flip
+ *
+ * Generated by tools/dedup_tiles.py from res/tiles_round.c - do not edit.
+ * 29 logical tiles, 18 unique tiles in VRAM, 126 bytes compressed.
+ * VRAM: bank 1 tiles 142-159.
+ */
+
+#include <gb/gb.h>
+#include <stdint.h>
+
+const uint8_t round_tiles_cgb[] = {
+    0x04, 0x80, 0x01, 0x8E, 0x81, 0x86, 0x00, 0x07, 0x05, 0x3F, 0x3F, 0x40,
+    0x7F, 0x80, 0xBF, 0xC7, 0x01, 0x04, 0xFF, 0xFF, 0x00, 0xFF, 0x89, 0x00,
+    0xC9, 0x1B, 0xCB, 0x0B, 0x04, 0x40, 0x7F, 0x3F, 0x3F, 0x8A, 0x00, 0x80,
+    0xFF, 0x07, 0x00, 0x00, 0x89, 0x30, 0x00, 0x18, 0x38, 0x80, 0x18, 0x09,
+    0x3C, 0x00, 0x00, 0x3C, 0x66, 0x06, 0x1C, 0x30, 0x7E, 0xC1, 0x07, 0x03,
+    0x1C, 0x06, 0x66, 0xC0, 0x0F, 0x0D, 0x0C, 0x1C, 0x2C, 0x4C, 0x7E, 0x0C,
+    0x00, 0x00, 0x7E, 0x60, 0x7C, 0x06, 0x46, 0xC0, 0x1F, 0x04, 0x1C, 0x30,
+    0x7C, 0x66, 0xC1, 0x17, 0x03, 0x7E, 0x06, 0x0C, 0x80, 0x18, 0xC1, 0x2F,
+    0x01, 0x3C, 0xC2, 0x0F, 0xC0, 0x05, 0xC1, 0x17, 0x02, 0x81, 0x11, 0x85,
+    0x00, 0x07, 0x01, 0x3F, 0x3F, 0x60, 0x7F, 0xC0, 0xE0, 0x87, 0xC0, 0x02,
+    0x81, 0x30, 0x85, 0xC0, 0x01, 0x00,
+};
+
+const uint8_t ROUND_TILES_CGB_COUNT = 18;
+
+/* Logical tile -> CGB VRAM tile */
+const uint8_t round_tile_ids[29] = {
+    142, 143, 144, 143, 145, 145, 146, 147, 146, 142,
+    148, 149, 150, 151, 152, 153, 154, 155, 153, 156,
+    157, 158, 144, 158, 159, 159, 158, 144, 158,
+};
+
+/* Logical tile -> BG attribute bits (0x20 X flip, 0x40 Y flip, 0x08 bank 1) */
+const uint8_t round_tile_attrs[29] = {
+    0x08, 0x08, 0x08, 0x28, 0x08, 0x28, 0x08, 0x08, 0x28, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x68, 0x08,
+    0x08, 0x08, 0x08, 0x28, 0x08, 0x28, 0x48, 0x48, 0x68,
+};
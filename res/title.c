@@ -0,0 +1,62 @@
+/*
+ * Title screen maps for the sliding puzzle game (Game Boy Color)
+ *
+ * Both maps cover the top 18 rows of the 32-column shadow, the screen
+ * at scroll (0, 0) with columns 20-31 off screen, and are
+ * RLE-compressed, one line per map row. Control bytes:
+ *   0x00         end of data
+ *   0x01 - 0x7F  that many literal bytes follow
+ *   0x81 - 0xFF  the next byte repeated (control & 0x7F) times
+ *
+ * Layout: screen border (tiles 1-8, palette 0), the "15" logo at (7, 5)
+ * (rewritten for the board size picked, see draw_logo in src/main.c)
+ * and a 4x4 mini-puzzle icon at (7, 7) showing 1, 2, 3 and the empty
+ * slot in palettes 1, 2, 3 and 5. Everything else uses palette 7.
+ */
+
+#include <gb/gb.h>
+#include <stdint.h>
+
+const uint8_t title_map_tiles[] = {
+    /*  0 */ 0x01, 1, 0x92, 2, 0x01, 3, 0x8C, 0,
+    /*  1 */ 0x01, 4, 0x92, 0, 0x01, 5, 0x8C, 0,
+    /*  2 */ 0x01, 4, 0x92, 0, 0x01, 5, 0x8C, 0,
+    /*  3 */ 0x01, 4, 0x92, 0, 0x01, 5, 0x8C, 0,
+    /*  4 */ 0x01, 4, 0x92, 0, 0x01, 5, 0x8C, 0,
+    /*  5 */ 0x01, 4, 0x86, 0, 0x03, 10, 0, 14, 0x89, 0, 0x01, 5, 0x8C, 0,
+    /*  6 */ 0x01, 4, 0x92, 0, 0x01, 5, 0x8C, 0,
+    /*  7 */ 0x01, 4, 0x86, 0, 0x04, 21, 22, 22, 23, 0x88, 0, 0x01, 5, 0x8C, 0,
+    /*  8 */ 0x01, 4, 0x86, 0, 0x04, 24, 10, 11, 25, 0x88, 0, 0x01, 5, 0x8C, 0,
+    /*  9 */ 0x01, 4, 0x86, 0, 0x04, 24, 12, 20, 25, 0x88, 0, 0x01, 5, 0x8C, 0,
+    /* 10 */ 0x01, 4, 0x86, 0, 0x04, 26, 27, 27, 28, 0x88, 0, 0x01, 5, 0x8C, 0,
+    /* 11 */ 0x01, 4, 0x92, 0, 0x01, 5, 0x8C, 0,
+    /* 12 */ 0x01, 4, 0x92, 0, 0x01, 5, 0x8C, 0,
+    /* 13 */ 0x01, 4, 0x92, 0, 0x01, 5, 0x8C, 0,
+    /* 14 */ 0x01, 4, 0x92, 0, 0x01, 5, 0x8C, 0,
+    /* 15 */ 0x01, 4, 0x92, 0, 0x01, 5, 0x8C, 0,
+    /* 16 */ 0x01, 4, 0x92, 0, 0x01, 5, 0x8C, 0,
+    /* 17 */ 0x01, 6, 0x92, 7, 0x01, 8, 0x8C, 0,
+    0x00
+};
+
+const uint8_t title_map_attrs[] = {
+    /*  0 */ 0xA0, 0,
+    /*  1 */ 0x01, 0, 0x92, 7, 0x8D, 0,
+    /*  2 */ 0x01, 0, 0x92, 7, 0x8D, 0,
+    /*  3 */ 0x01, 0, 0x92, 7, 0x8D, 0,
+    /*  4 */ 0x01, 0, 0x92, 7, 0x8D, 0,
+    /*  5 */ 0x01, 0, 0x92, 7, 0x8D, 0,
+    /*  6 */ 0x01, 0, 0x92, 7, 0x8D, 0,
+    /*  7 */ 0x01, 0, 0x92, 7, 0x8D, 0,
+    /*  8 */ 0x01, 0, 0x87, 7, 0x02, 1, 2, 0x89, 7, 0x8D, 0,
+    /*  9 */ 0x01, 0, 0x87, 7, 0x02, 3, 5, 0x89, 7, 0x8D, 0,
+    /* 10 */ 0x01, 0, 0x92, 7, 0x8D, 0,
+    /* 11 */ 0x01, 0, 0x92, 7, 0x8D, 0,
+    /* 12 */ 0x01, 0, 0x92, 7, 0x8D, 0,
+    /* 13 */ 0x01, 0, 0x92, 7, 0x8D, 0,
+    /* 14 */ 0x01, 0, 0x92, 7, 0x8D, 0,
+    /* 15 */ 0x01, 0, 0x92, 7, 0x8D, 0,
+    /* 16 */ 0x01, 0, 0x92, 7, 0x8D, 0,
+    /* 17 */ 0xA0, 0,
+    0x00
+};
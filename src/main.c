@@ -4,7 +4,10 @@
  *
  * Slide numbered tiles into order using the D-pad.
  * The goal is to arrange tiles 1-15 in order with the
- * empty space in the bottom-right corner.
+ * empty space in the bottom-right corner. Boards from 4x4 up to 8x8
+ * are picked on the title screen; boards taller or wider than the
+ * screen scroll to follow the cursor. Larger boards are drawn with
+ * smaller cells so they fit on screen; B zooms in to full-size cells.
  */
 
 #include <gb/gb.h>
@@ -12,24 +15,54 @@
 #include <stdint.h>
 #include <rand.h>
 
-/* External tile data */
-extern const unsigned char puzzle_tiles[];
+#include "render.h"
+#include "tileset.h"
+#include "picture.h"
+
+/* External tile data (compressed tile sets, see src/tileset.h): one
+   logical set, CGB set and translation per theme */
+extern const uint8_t puzzle_tiles[];
 extern const uint8_t PUZZLE_TILES_COUNT;
+extern const uint8_t puzzle_tiles_cgb[];
+extern const uint8_t puzzle_tile_ids[];
+extern const uint8_t puzzle_tile_attrs[];
+extern const uint8_t round_tiles[];
+extern const uint8_t round_tiles_cgb[];
+extern const uint8_t round_tile_ids[];
+extern const uint8_t round_tile_attrs[];
+extern const unsigned char sprite_tiles[];
+extern const uint8_t SPRITE_TILES_COUNT;
+extern const uint8_t title_map_tiles[];
+extern const uint8_t title_map_attrs[];
+extern const uint8_t digit_font[10][5];
 
 /* ======== Constants ======== */
 
-/* Grid dimensions */
-#define GRID_SIZE    4
-#define TOTAL_TILES  16
+/* Grid dimensions: grid_size x grid_size cells, picked on the title
+   screen. Tile values run up to TILES_MAX - 1 on the largest board. */
+#define GRID_MIN     4
+#define GRID_MAX     8
+#define TILES_MAX    (GRID_MAX * GRID_MAX)
 #define EMPTY_TILE   0
 
-/* Each puzzle cell is 3x3 background tiles on screen */
-#define CELL_W  3
-#define CELL_H  3
+/* Puzzle cells are square, 3x3, 2x2 or 1x1 background tiles: the
+   largest that fit the board on screen, or 3x3 and scrolling while
+   zoomed in. Each size has its own stamp tables (see Metatiles). */
+#define CELL_MAX  3
+#define CELL_MIN  1
+
+/* Tiles an n x n board of s x s cells spans with its border */
+#define BOARD_SPAN(n, s)  ((n) * (s) + 2)
 
-/* Grid position on screen (in BG tile coordinates) */
-#define GRID_X  4
-#define GRID_Y  3
+/* Window HUD position of the move counter (screen row 17), and its
+   width in digits */
+#define HUD_MOVES_X  3
+#define HUD_MOVES_Y  1
+#define MOVE_DIGITS  5
+
+/* Title logo: the number of tiles on the board, "15" for 4x4 */
+#define LOGO_X  7
+#define LOGO_Y  5
 
 /* Tile indices in VRAM */
 #define T_BLANK      0
@@ -43,20 +76,45 @@ extern const uint8_t PUZZLE_TILES_COUNT;
 #define T_BORDER_BR  8
 #define T_CELL_BG    9
 #define T_NUM_START  10   /* Tiles 10-18: digits 1-9 */
-#define T_NUM10_L    19   /* Two-digit number left halves start */
-#define T_EMPTY_CELL 31   /* Dark empty cell */
-#define T_TILE_TL    32   /* Puzzle tile border pieces */
-#define T_TILE_T     33
-#define T_TILE_TR    34
-#define T_TILE_L     35
-#define T_TILE_R     36
-#define T_TILE_BL    37
-#define T_TILE_B     38
-#define T_TILE_BR    39
+#define T_DIGIT_0    19   /* Digit 0, for the HUD */
+#define T_EMPTY_CELL 20   /* Dark empty cell */
+#define T_TILE_TL    21   /* Puzzle tile border pieces */
+#define T_TILE_T     22
+#define T_TILE_TR    23
+#define T_TILE_L     24
+#define T_TILE_R     25
+#define T_TILE_BL    26
+#define T_TILE_B     27
+#define T_TILE_BR    28
+#define T_NUMBERS    32   /* Numbers 10 and up, composed by init_numbers */
+
+/* Sprite tiles and OAM slots */
+#define SPR_T_CORNER 0    /* Cursor corner bracket */
+#define SPR_T_PUZZLE 1    /* Opaque copies of the puzzle tiles follow */
+#define SPR_CURSOR   0    /* OAM 0-3: cursor corners TL, TR, BL, BR */
+#define SPR_SLIDE    4    /* OAM 4-12: up to 3x3 group for the sliding tile */
+
+/* Slide animation length in frames (at least 1) */
+#define SLIDE_FRAMES 8
+
+/* Win flash: palettes 1-5 fade to gold in WIN_FADE_STEPS frames,
+   hold, fade back and hold, WIN_PULSES times */
+#define WIN_PAL_FIRST   1
+#define WIN_PAL_COUNT   5
+#define WIN_FADE_STEPS  8
+#define WIN_HOLD        12
+#define WIN_PULSES      3
 
 /* Input delay */
 #define INPUT_DELAY  6
 
+/* Cursor glide speed in pixels per frame (a 24px cell takes INPUT_DELAY frames) */
+#define CURSOR_STEP  4
+
+/* The camera glides like the cursor and keeps this many pixels around
+   the selected cell in view */
+#define CAMERA_MARGIN  8
+
 /* ======== Color Palettes ======== */
 
 /* GBC background palettes */
@@ -112,8 +170,26 @@ static const uint16_t bg_palettes[] = {
 
 /* ======== Game State ======== */
 
-/* The puzzle board: board[row][col] = tile number (1-15), 0 = empty */
-uint8_t board[GRID_SIZE][GRID_SIZE];
+/* The puzzle board: board[row][col] = tile number (1 up), 0 = empty;
+   only the top-left grid_size x grid_size corner is used */
+uint8_t board[GRID_MAX][GRID_MAX];
+
+/* Board size, tile count, cell size in tiles, and whether the player
+   zoomed in to 3x3 cells (B during a game) */
+uint8_t grid_size;
+uint8_t total_tiles;
+uint8_t cell_size;
+uint8_t zoomed;
+
+/* Map tile column of each grid column and row of each grid row, so no
+   move multiplies by the cell size */
+uint8_t cell_mx[GRID_MAX];
+uint8_t cell_my[GRID_MAX];
+
+/* Camera: the map pixel at the top-left of the screen, passed to
+   render_scroll, and its limits for the current board */
+uint8_t camera_x, camera_y;
+uint8_t camera_max_x, camera_max_y;
 
 /* Position of the empty cell */
 uint8_t empty_row, empty_col;
@@ -121,8 +197,37 @@ uint8_t empty_row, empty_col;
 /* Cursor position */
 uint8_t cursor_row, cursor_col;
 
-/* Move counter */
-uint16_t move_count;
+/* Cursor position in map pixels (top-left pixel of the cell it is framing) */
+uint8_t cursor_px, cursor_py;
+
+/* Slide animation: frame counter (0 = idle), start map pixel, direction,
+   destination cell and a move requested while the slide was running */
+uint8_t slide_frame;
+uint8_t slide_px, slide_py;
+int8_t slide_dx, slide_dy;
+uint8_t slide_row, slide_col;
+uint8_t move_buffered;
+
+/* Pixel offset along the slide for each frame, filled by init_slide */
+uint8_t slide_offsets[SLIDE_FRAMES];
+
+/* Palettes 1-5 blended toward gold, one set per fade step, and the DMG
+   BGP values for the same steps (shades blended toward their inverse) */
+uint16_t win_fade[WIN_FADE_STEPS + 1][WIN_PAL_COUNT * 4];
+uint8_t win_fade_bgp[WIN_FADE_STEPS + 1];
+
+/* Move counter, packed BCD with the low digit pair first:
+   move_bcd[0] = tens/ones, [1] = thousands/hundreds, [2] = ten thousands */
+uint8_t move_bcd[3];
+
+/* Current tile theme, an index into themes[], and whether its cells
+   show the picture */
+uint8_t theme;
+uint8_t cell_picture;
+
+/* BG palette of each tile value: one palette per board row, cycling
+   through palettes 1-4, and palette 5 for the empty cell */
+uint8_t cell_pal[TILES_MAX];
 
 /* Game state flags */
 uint8_t game_won;
@@ -136,105 +241,225 @@ uint16_t seed_counter;
 
 /* Simple font - we'll use the number tiles for digits
    and leave letters as blanks for now */
-void put_char(uint8_t x, uint8_t y, char c) {
+uint8_t char_tile(char c) {
     uint8_t tile = T_BLANK;
     if (c >= '0' && c <= '9') {
         uint8_t digit = c - '0';
         if (digit == 0) {
-            tile = T_NUM10_L + 1;  /* Use the "0" tile (tile 20) */
+            tile = T_DIGIT_0;
         } else {
             tile = T_NUM_START + digit - 1;  /* tiles 10-18 for 1-9 */
         }
     }
-    set_bkg_tile_xy(x, y, tile);
+    return tile;
 }
 
-void put_number(uint8_t x, uint8_t y, uint16_t num) {
-    /* Draw a number right-aligned in a 3-digit field */
-    uint8_t hundreds = num / 100;
-    uint8_t tens = (num / 10) % 10;
-    uint8_t ones = num % 10;
+/* Add one to the move counter in place. Returns how many digits
+   changed, counting up from the ones digit (1 plus one per carry), or
+   0 once the counter stops at 99999. */
+uint8_t bump_moves(void) {
+    uint8_t i, changed = 1;
 
-    if (hundreds > 0) {
-        put_char(x, y, '0' + hundreds);
-        put_char(x + 1, y, '0' + tens);
-        put_char(x + 2, y, '0' + ones);
-    } else if (tens > 0) {
-        set_bkg_tile_xy(x, y, T_BLANK);
-        put_char(x + 1, y, '0' + tens);
-        put_char(x + 2, y, '0' + ones);
-    } else {
-        set_bkg_tile_xy(x, y, T_BLANK);
-        set_bkg_tile_xy(x + 1, y, T_BLANK);
-        put_char(x + 2, y, '0' + ones);
+    if (move_bcd[2] == 0x09 && move_bcd[1] == 0x99 && move_bcd[0] == 0x99) return 0;
+
+    for (i = 0; i < 3; i++) {
+        uint8_t b = move_bcd[i];
+        if ((b & 0x0F) != 0x09) {
+            move_bcd[i] = b + 1;
+            break;
+        }
+        changed++;
+        if ((b & 0xF0) != 0x90) {
+            move_bcd[i] = (b & 0xF0) + 0x10;
+            break;
+        }
+        changed++;
+        move_bcd[i] = 0;
     }
+    return changed;
 }
 
-/* ======== Drawing Functions ======== */
+/* Draw the lowest n digits of the move counter, right-aligned in a
+   MOVE_DIGITS field with leading zeros blank */
+void draw_moves(uint8_t n) {
+    uint8_t tiles[MOVE_DIGITS];
+    uint8_t i, blank = 1;
+
+    /* tiles[0] is the most significant digit */
+    for (i = 0; i < MOVE_DIGITS; i++) {
+        uint8_t p = MOVE_DIGITS - 1 - i;
+        uint8_t d = move_bcd[p >> 1];
+        if (p & 1) d >>= 4;
+        d &= 0x0F;
+        if (d || p == 0) blank = 0;
+        tiles[i] = blank ? T_BLANK : char_tile('0' + d);
+    }
 
-/* Get the color palette index for a tile number */
-uint8_t get_tile_palette(uint8_t tile_num) {
-    if (tile_num == 0) return 5;       /* Empty = dark palette */
-    if (tile_num <= 4) return 1;       /* 1-4 = blue */
-    if (tile_num <= 8) return 2;       /* 5-8 = green */
-    if (tile_num <= 12) return 3;      /* 9-12 = orange */
-    return 4;                          /* 13-15 = purple */
+    render_hud_put(HUD_MOVES_X + MOVE_DIGITS - n, HUD_MOVES_Y, n,
+                   tiles + MOVE_DIGITS - n, 7);
 }
 
-/* Draw a single puzzle cell at grid position (gx, gy) */
-void draw_cell(uint8_t gx, uint8_t gy) {
-    uint8_t tile_num = board[gy][gx];
-    uint8_t sx = GRID_X + gx * CELL_W;  /* Screen X in BG tiles */
-    uint8_t sy = GRID_Y + gy * CELL_H;  /* Screen Y in BG tiles */
-    uint8_t pal = get_tile_palette(tile_num);
+/* ======== Metatiles ======== */
+
+/* Everything on the board is drawn as metatiles: precomputed tile and
+   attribute blocks, stored row-major and drawn by render_metatile.
+   Cells are square stamps: per cell size, a tile stamp per tile value
+   and an attribute stamp per palette, all generated from the same
+   lists by the size's STAMP_ and PAL_ macros and paired up by
+   cell_metatile. The border is built from 1x1 corners and edge pieces
+   one cell long, so it fits any grid and cell size. */
+
+/* 3x3: a frame ring around the number */
+#define STAMP_3X3(center) { \
+    T_TILE_TL, T_TILE_T,  T_TILE_TR, \
+    T_TILE_L,  (center),  T_TILE_R,  \
+    T_TILE_BL, T_TILE_B,  T_TILE_BR }
+
+/* 2x2: the number with the frame's right and bottom edges; the cell to
+   the left or above (or the border) closes it off */
+#define STAMP_2X2(center) { \
+    (center),  T_TILE_R, \
+    T_TILE_B,  T_TILE_BR }
+
+/* 1x1: the number alone, the palette sets the cells apart */
+#define STAMP_1X1(center) { (center) }
+
+#define PAL_3X3(p)  { p, p, p, p, p, p, p, p, p }
+#define PAL_2X2(p)  { p, p, p, p }
+#define PAL_1X1(p)  { p }
+
+/* Every tile value, 0 = empty up to TILES_MAX - 1. Two-digit numbers
+   fit the center tile in the half-width font. */
+#define NUM_STAMP(STAMP, n)     STAMP(T_NUMBERS + (n) - 10)
+#define NUM_STAMPS_6(STAMP, n) \
+    NUM_STAMP(STAMP, n),     NUM_STAMP(STAMP, n + 1), NUM_STAMP(STAMP, n + 2), \
+    NUM_STAMP(STAMP, n + 3), NUM_STAMP(STAMP, n + 4), NUM_STAMP(STAMP, n + 5)
+
+#define CELL_TILE_STAMPS(STAMP) { \
+    STAMP(T_EMPTY_CELL), \
+    STAMP(T_NUM_START + 0), STAMP(T_NUM_START + 1), STAMP(T_NUM_START + 2), \
+    STAMP(T_NUM_START + 3), STAMP(T_NUM_START + 4), STAMP(T_NUM_START + 5), \
+    STAMP(T_NUM_START + 6), STAMP(T_NUM_START + 7), STAMP(T_NUM_START + 8), \
+    NUM_STAMPS_6(STAMP, 10), NUM_STAMPS_6(STAMP, 16), NUM_STAMPS_6(STAMP, 22), \
+    NUM_STAMPS_6(STAMP, 28), NUM_STAMPS_6(STAMP, 34), NUM_STAMPS_6(STAMP, 40), \
+    NUM_STAMPS_6(STAMP, 46), NUM_STAMPS_6(STAMP, 52), NUM_STAMPS_6(STAMP, 58) }
+
+/* By palette (see cell_pal): 1-4 for the board rows, 5 = empty */
+#define CELL_ATTR_STAMPS(PAL) { \
+    PAL(0), PAL(1), PAL(2), PAL(3), PAL(4), PAL(5) }
+
+/* The empty cell keeps the frame pieces in the dark palette, so a swap
+   between empty and a number changes only the center tile(s) and the
+   attributes; render_metatile uploads just those */
+static const uint8_t cell_tiles_3x3[TILES_MAX][3 * 3] = CELL_TILE_STAMPS(STAMP_3X3);
+static const uint8_t cell_tiles_2x2[TILES_MAX][2 * 2] = CELL_TILE_STAMPS(STAMP_2X2);
+static const uint8_t cell_tiles_1x1[TILES_MAX][1 * 1] = CELL_TILE_STAMPS(STAMP_1X1);
+
+static const uint8_t cell_attrs_3x3[6][3 * 3] = CELL_ATTR_STAMPS(PAL_3X3);
+static const uint8_t cell_attrs_2x2[6][2 * 2] = CELL_ATTR_STAMPS(PAL_2X2);
+static const uint8_t cell_attrs_1x1[6][1 * 1] = CELL_ATTR_STAMPS(PAL_1X1);
+
+/* Picture mode (4x4 boards, so always 3x3 cells): cells show their
+   slice of the picture from VRAM bank 1 (see src/picture.h) in the same
+   palettes; the empty cell is as above */
+#define PIC_STAMP(n) { \
+    PIC_TILE(n, 0), PIC_TILE(n, 1), PIC_TILE(n, 2), \
+    PIC_TILE(n, 3), PIC_TILE(n, 4), PIC_TILE(n, 5), \
+    PIC_TILE(n, 6), PIC_TILE(n, 7), PIC_TILE(n, 8) }
+
+#define PIC_PAL_STAMP(p)  PAL_3X3((p) | ATTR_BANK1)
+
+static const uint8_t pic_tile_stamps[PIC_CELLS + 1][3 * 3] = {
+    STAMP_3X3(T_EMPTY_CELL),
+    PIC_STAMP(1),  PIC_STAMP(2),  PIC_STAMP(3),  PIC_STAMP(4),
+    PIC_STAMP(5),  PIC_STAMP(6),  PIC_STAMP(7),  PIC_STAMP(8),
+    PIC_STAMP(9),  PIC_STAMP(10), PIC_STAMP(11), PIC_STAMP(12),
+    PIC_STAMP(13), PIC_STAMP(14), PIC_STAMP(15),
+};
 
-    /* Set CGB attributes (palette) for this 3x3 area */
-    VBK_REG = 1;  /* Switch to attribute map */
-    uint8_t r, c_idx;
-    for (r = 0; r < CELL_H; r++) {
-        for (c_idx = 0; c_idx < CELL_W; c_idx++) {
-            set_bkg_tile_xy(sx + c_idx, sy + r, pal);
-        }
-    }
-    VBK_REG = 0;  /* Switch back to tile map */
+static const uint8_t pic_attr_stamps[6][3 * 3] = {
+    PAL_3X3(0),       PIC_PAL_STAMP(1), PIC_PAL_STAMP(2),
+    PIC_PAL_STAMP(3), PIC_PAL_STAMP(4), PAL_3X3(5),
+};
 
-    if (tile_num == 0) {
-        /* Empty cell - fill with dark tiles */
-        for (r = 0; r < CELL_H; r++) {
-            for (c_idx = 0; c_idx < CELL_W; c_idx++) {
-                set_bkg_tile_xy(sx + c_idx, sy + r, T_EMPTY_CELL);
+static const uint8_t border_corner_tiles[4] = {
+    T_BORDER_TL, T_BORDER_TR, T_BORDER_BL, T_BORDER_BR
+};
+static const uint8_t border_top_tiles[CELL_MAX] = { T_BORDER_T, T_BORDER_T, T_BORDER_T };
+static const uint8_t border_bottom_tiles[CELL_MAX] = { T_BORDER_B, T_BORDER_B, T_BORDER_B };
+static const uint8_t border_left_tiles[CELL_MAX] = { T_BORDER_L, T_BORDER_L, T_BORDER_L };
+static const uint8_t border_right_tiles[CELL_MAX] = { T_BORDER_R, T_BORDER_R, T_BORDER_R };
+
+/* The border uses palette 0 throughout */
+static const uint8_t border_attrs[CELL_MAX] = { 0 };
+
+/* Border metatiles, one set per cell size (index cell_size - 1) */
+#define MT_BORDER_TL   0
+#define MT_BORDER_TR   1
+#define MT_BORDER_BL   2
+#define MT_BORDER_BR   3
+#define MT_BORDER_T    4
+#define MT_BORDER_B    5
+#define MT_BORDER_L    6
+#define MT_BORDER_R    7
+#define MT_BORDER_COUNT 8
+
+#define BORDER_METATILES(n) { \
+    { 1, 1, &border_corner_tiles[0], border_attrs }, \
+    { 1, 1, &border_corner_tiles[1], border_attrs }, \
+    { 1, 1, &border_corner_tiles[2], border_attrs }, \
+    { 1, 1, &border_corner_tiles[3], border_attrs }, \
+    { n, 1, border_top_tiles, border_attrs }, \
+    { n, 1, border_bottom_tiles, border_attrs }, \
+    { 1, n, border_left_tiles, border_attrs }, \
+    { 1, n, border_right_tiles, border_attrs } }
+
+static const metatile_t border_metatiles[CELL_MAX][MT_BORDER_COUNT] = {
+    BORDER_METATILES(1), BORDER_METATILES(2), BORDER_METATILES(3),
+};
+
+/* Fill in the cell metatile for tile value v in the current theme and
+   cell size. Each size indexes its own tables, so the stamp offsets
+   are constant shifts and adds rather than a multiply. */
+void cell_metatile(metatile_t *mt, uint8_t v) {
+    uint8_t pal = cell_pal[v];
+
+    mt->w = cell_size;
+    mt->h = cell_size;
+    switch (cell_size) {
+        case 3:
+            if (cell_picture && v != EMPTY_TILE) {
+                mt->tiles = pic_tile_stamps[v];
+                mt->attrs = pic_attr_stamps[pal];
+            } else {
+                mt->tiles = cell_tiles_3x3[v];
+                mt->attrs = cell_attrs_3x3[pal];
             }
-        }
-    } else {
-        /* Draw tile border */
-        set_bkg_tile_xy(sx, sy, T_TILE_TL);
-        set_bkg_tile_xy(sx + 1, sy, T_TILE_T);
-        set_bkg_tile_xy(sx + 2, sy, T_TILE_TR);
-        set_bkg_tile_xy(sx, sy + 1, T_TILE_L);
-        set_bkg_tile_xy(sx + 2, sy + 1, T_TILE_R);
-        set_bkg_tile_xy(sx, sy + 2, T_TILE_BL);
-        set_bkg_tile_xy(sx + 1, sy + 2, T_TILE_B);
-        set_bkg_tile_xy(sx + 2, sy + 2, T_TILE_BR);
-
-        /* Draw number in center */
-        if (tile_num <= 9) {
-            /* Single digit: use tiles 10-18 (digit 1 = tile 10, etc.) */
-            set_bkg_tile_xy(sx + 1, sy + 1, T_NUM_START + tile_num - 1);
-        } else {
-            /* Two digits: 10-15 use paired tiles */
-            uint8_t pair_base = T_NUM10_L + (tile_num - 10) * 2;
-            set_bkg_tile_xy(sx, sy + 1, T_TILE_L);
-            set_bkg_tile_xy(sx + 1, sy + 1, pair_base);      /* tens digit */
-            set_bkg_tile_xy(sx + 2, sy + 1, pair_base + 1);  /* ones digit */
-        }
+            break;
+        case 2:
+            mt->tiles = cell_tiles_2x2[v];
+            mt->attrs = cell_attrs_2x2[pal];
+            break;
+        default:
+            mt->tiles = cell_tiles_1x1[v];
+            mt->attrs = cell_attrs_1x1[pal];
+            break;
     }
 }
 
+/* Draw a single puzzle cell at grid position (gx, gy) */
+void draw_cell(uint8_t gx, uint8_t gy) {
+    metatile_t mt;
+
+    cell_metatile(&mt, board[gy][gx]);
+    render_metatile(cell_mx[gx], cell_my[gy], &mt);
+}
+
 /* Draw the entire puzzle board */
 void draw_board(void) {
     uint8_t gx, gy;
-    for (gy = 0; gy < GRID_SIZE; gy++) {
-        for (gx = 0; gx < GRID_SIZE; gx++) {
+    for (gy = 0; gy < grid_size; gy++) {
+        for (gx = 0; gx < grid_size; gx++) {
             draw_cell(gx, gy);
         }
     }
@@ -242,93 +467,453 @@ void draw_board(void) {
 
 /* Draw the outer border around the puzzle */
 void draw_border(void) {
+    const metatile_t *mts = border_metatiles[cell_size - 1];
     uint8_t i;
-    uint8_t x1 = GRID_X - 1;
-    uint8_t y1 = GRID_Y - 1;
-    uint8_t x2 = GRID_X + GRID_SIZE * CELL_W;
-    uint8_t y2 = GRID_Y + GRID_SIZE * CELL_H;
+    uint8_t left = cell_mx[0] - 1;
+    uint8_t top = cell_my[0] - 1;
+    uint8_t right = cell_mx[grid_size - 1] + cell_size;
+    uint8_t bottom = cell_my[grid_size - 1] + cell_size;
+
+    render_metatile(left, top, &mts[MT_BORDER_TL]);
+    render_metatile(right, top, &mts[MT_BORDER_TR]);
+    render_metatile(left, bottom, &mts[MT_BORDER_BL]);
+    render_metatile(right, bottom, &mts[MT_BORDER_BR]);
+
+    /* One edge piece per cell along each side */
+    for (i = 0; i < grid_size; i++) {
+        render_metatile(cell_mx[i], top, &mts[MT_BORDER_T]);
+        render_metatile(cell_mx[i], bottom, &mts[MT_BORDER_B]);
+        render_metatile(left, cell_my[i], &mts[MT_BORDER_L]);
+        render_metatile(right, cell_my[i], &mts[MT_BORDER_R]);
+    }
+}
+
+/* Draw the move counter on the window HUD */
+void draw_hud(void) {
+    uint8_t y;
 
-    /* Set palette for border */
-    VBK_REG = 1;
-    for (i = x1; i <= x2; i++) {
-        set_bkg_tile_xy(i, y1, 0);
-        set_bkg_tile_xy(i, y2, 0);
+    /* Clear every window row, with the palette for HUD text; rows the
+       counter does not use would otherwise show whatever VRAM held */
+    for (y = 0; y < HUD_H; y++) {
+        render_hud_repeat(0, y, HUD_W, T_BLANK, 7);
     }
-    for (i = y1; i <= y2; i++) {
-        set_bkg_tile_xy(x1, i, 0);
-        set_bkg_tile_xy(x2, i, 0);
+
+    /* "MOVES:" label - we'll just show the number since we lack font tiles */
+    /* Draw the move count */
+    draw_moves(MOVE_DIGITS);
+}
+
+/* ======== Cursor Sprites ======== */
+
+/* Map pixel position of a grid cell's top-left corner */
+#define CELL_PX(gx)  ((uint8_t)(cell_mx[gx] << 3))
+#define CELL_PY(gy)  ((uint8_t)(cell_my[gy] << 3))
+
+/* Set up the corner sprites: one bracket tile, flipped for each corner */
+void init_cursor(void) {
+    set_sprite_data(SPR_T_CORNER, SPRITE_TILES_COUNT, sprite_tiles);
+
+    /* Sprite palette 0 = the gold win-state colors */
+    set_sprite_palette(0, 1, &bg_palettes[6 * 4]);
+
+    set_sprite_tile(SPR_CURSOR + 0, SPR_T_CORNER);
+    set_sprite_tile(SPR_CURSOR + 1, SPR_T_CORNER);
+    set_sprite_tile(SPR_CURSOR + 2, SPR_T_CORNER);
+    set_sprite_tile(SPR_CURSOR + 3, SPR_T_CORNER);
+    set_sprite_prop(SPR_CURSOR + 0, 0);
+    set_sprite_prop(SPR_CURSOR + 1, S_FLIPX);
+    set_sprite_prop(SPR_CURSOR + 2, S_FLIPY);
+    set_sprite_prop(SPR_CURSOR + 3, S_FLIPX | S_FLIPY);
+
+    /* DMG: draw the bracket (color 2) in black through OBP0 */
+    OBP0_REG = DMG_PALETTE(DMG_WHITE, DMG_LITE_GRAY, DMG_BLACK, DMG_BLACK);
+
+    SHOW_SPRITES;
+}
+
+/* Move the corner sprites around the cell at map pixel (cursor_px,
+   cursor_py), as seen from the camera. Only the shadow OAM changes; it
+   reaches the PPU in the next VBlank DMA, with the scroll. */
+void place_cursor(void) {
+    /* OAM coordinates are offset by (8, 16) from the screen */
+    uint8_t x = cursor_px - camera_x + 8;
+    uint8_t y = cursor_py - camera_y + 16;
+    uint8_t x2 = x + ((cell_size - 1) << 3);
+    uint8_t y2 = y + ((cell_size - 1) << 3);
+
+    move_sprite(SPR_CURSOR + 0, x, y);
+    move_sprite(SPR_CURSOR + 1, x2, y);
+    move_sprite(SPR_CURSOR + 2, x, y2);
+    move_sprite(SPR_CURSOR + 3, x2, y2);
+}
+
+/* Jump the cursor straight to the selected cell */
+void show_cursor(void) {
+    cursor_px = CELL_PX(cursor_col);
+    cursor_py = CELL_PY(cursor_row);
+    place_cursor();
+}
+
+void hide_cursor(void) {
+    uint8_t i;
+    for (i = 0; i < 4; i++) {
+        move_sprite(SPR_CURSOR + i, 0, 0);
     }
-    VBK_REG = 0;
+}
 
-    /* Corners */
-    set_bkg_tile_xy(x1, y1, T_BORDER_TL);
-    set_bkg_tile_xy(x2, y1, T_BORDER_TR);
-    set_bkg_tile_xy(x1, y2, T_BORDER_BL);
-    set_bkg_tile_xy(x2, y2, T_BORDER_BR);
+/* Step one coordinate toward its target by at most CURSOR_STEP */
+uint8_t glide(uint8_t pos, uint8_t target) {
+    if (pos < target) {
+        pos += CURSOR_STEP;
+        if (pos > target) pos = target;
+    } else if (pos > target) {
+        pos -= CURSOR_STEP;
+        if (pos < target) pos = target;
+    }
+    return pos;
+}
 
-    /* Top and bottom edges */
-    for (i = x1 + 1; i < x2; i++) {
-        set_bkg_tile_xy(i, y1, T_BORDER_T);
-        set_bkg_tile_xy(i, y2, T_BORDER_B);
+/* Called once per frame: glide the cursor toward the selected cell.
+   The sprite position doubles as the last-drawn position, so a cursor
+   at rest (including a press clamped at the grid edge) writes nothing
+   unless the camera moved, and a moving one updates all four corners
+   in one shadow-OAM pass. */
+void update_cursor(uint8_t camera_moved) {
+    uint8_t tx = CELL_PX(cursor_col);
+    uint8_t ty = CELL_PY(cursor_row);
+
+    if (cursor_px == tx && cursor_py == ty) {
+        if (camera_moved) place_cursor();
+        return;
     }
 
-    /* Left and right edges */
-    for (i = y1 + 1; i < y2; i++) {
-        set_bkg_tile_xy(x1, i, T_BORDER_L);
-        set_bkg_tile_xy(x2, i, T_BORDER_R);
+    cursor_px = glide(cursor_px, tx);
+    cursor_py = glide(cursor_py, ty);
+    place_cursor();
+}
+
+/* ======== Camera ======== */
+
+/* The camera position along one axis that shows the cell starting at
+   map pixel cell, with CAMERA_MARGIN around it, moving as little as
+   possible from pos; view is the screen size and max the limit */
+uint8_t camera_target(uint8_t pos, uint8_t cell, uint8_t view, uint8_t max) {
+    uint16_t lo = cell < CAMERA_MARGIN ? 0 : cell - CAMERA_MARGIN;
+    uint16_t hi = (uint16_t)cell + (cell_size << 3) + CAMERA_MARGIN;
+
+    if (lo < pos) {
+        pos = (uint8_t)lo;
+    } else if (hi > (uint16_t)pos + view) {
+        pos = (uint8_t)(hi - view);
     }
+    return pos > max ? max : pos;
 }
 
-/* Draw the move counter in the HUD area */
-void draw_hud(void) {
-    uint8_t y = GRID_Y + GRID_SIZE * CELL_H + 2;
+/* Called once per frame: glide the camera toward the selected cell and
+   hand it to the renderer. Returns 1 if it moved. */
+uint8_t update_camera(void) {
+    uint8_t tx = camera_target(camera_x, CELL_PX(cursor_col), VIEW_W * 8, camera_max_x);
+    uint8_t ty = camera_target(camera_y, CELL_PY(cursor_row), VIEW_H * 8, camera_max_y);
 
-    /* Set palette for HUD text */
-    VBK_REG = 1;
+    if (camera_x == tx && camera_y == ty) return 0;
+
+    camera_x = glide(camera_x, tx);
+    camera_y = glide(camera_y, ty);
+    render_scroll(camera_x, camera_y);
+    return 1;
+}
+
+/* ======== Slide Animation ======== */
+
+/* Precompute the easing table for a slide of one cell at the current
+   cell size: smoothstep ease-in/out, t runs 0..16, and t*t*(48 - 2t)
+   runs 0..4096, scaled to 0..cell_size*8 pixels (shifted down first so
+   the product stays within 16 bits) */
+void init_easing(void) {
     uint8_t i;
-    for (i = GRID_X; i < GRID_X + 8; i++) {
-        set_bkg_tile_xy(i, y, 7);
+
+    for (i = 0; i < SLIDE_FRAMES; i++) {
+        uint16_t t = (uint16_t)(i + 1) * 16 / SLIDE_FRAMES;
+        uint16_t v = t * t * (48 - 2 * t);
+        slide_offsets[i] = (uint8_t)(((v >> 4) * (cell_size << 3)) >> 8);
     }
-    VBK_REG = 0;
+}
 
-    /* "MOVES:" label - we'll just show the number since we lack font tiles */
-    /* Draw the move count */
-    put_number(GRID_X + 1, y, move_count);
-}
-
-/* Draw cursor highlight around selected cell */
-void draw_cursor(uint8_t gx, uint8_t gy, uint8_t show) {
-    uint8_t sx = GRID_X + gx * CELL_W;
-    uint8_t sy = GRID_Y + gy * CELL_H;
-
-    /* Use win-state palette (gold) for cursor highlight */
-    VBK_REG = 1;
-    if (show) {
-        /* Set corners to gold palette to highlight */
-        set_bkg_tile_xy(sx, sy, 6);
-        set_bkg_tile_xy(sx + 2, sy, 6);
-        set_bkg_tile_xy(sx, sy + 2, 6);
-        set_bkg_tile_xy(sx + 2, sy + 2, 6);
+/* Load the sprite palettes that match palettes 1-4. The sliding
+   sprites are opaque copies of the puzzle tiles, loaded with each
+   theme. Cell tiles never use color 1, so
+   color 0 (transparent for sprites) is remapped to it and color 1 of
+   each sprite palette takes the cell background color. */
+void init_slide(void) {
+    uint16_t pals[4 * 4];
+    uint8_t i;
+
+    for (i = 0; i < 4; i++) {
+        const uint16_t *bg = &bg_palettes[(i + 1) * 4];
+        pals[i * 4 + 0] = bg[0];
+        pals[i * 4 + 1] = bg[0];
+        pals[i * 4 + 2] = bg[2];
+        pals[i * 4 + 3] = bg[3];
+    }
+    set_sprite_palette(1, 4, pals);
+
+    /* DMG: sliding tiles use OBP1 with the same remap */
+    OBP1_REG = DMG_PALETTE(DMG_WHITE, DMG_WHITE, DMG_DARK_GRAY, DMG_BLACK);
+}
+
+/* Move the cell's sprite group to the current point of the slide, as
+   seen from the camera */
+void place_slide(void) {
+    uint8_t off = slide_offsets[slide_frame - 1];
+    uint8_t x = slide_px - camera_x + 8;
+    uint8_t y = slide_py - camera_y + 16;
+    uint8_t r, c, i = SPR_SLIDE;
+
+    if (slide_dx > 0) x += off;
+    if (slide_dx < 0) x -= off;
+    if (slide_dy > 0) y += off;
+    if (slide_dy < 0) y -= off;
+
+    for (r = 0; r < cell_size; r++) {
+        for (c = 0; c < cell_size; c++) {
+            move_sprite(i++, x + c * 8, y + r * 8);
+        }
+    }
+}
+
+/* Lift the tile now stored at (to_r, to_c) into sprites at its old cell
+   (from_r, from_c); the BG cell is drawn only when the slide commits */
+void start_slide(uint8_t from_r, uint8_t from_c, uint8_t to_r, uint8_t to_c) {
+    metatile_t mt;
+    const uint8_t *tiles;
+    const uint8_t *attrs;
+    uint8_t i;
+
+    cell_metatile(&mt, board[to_r][to_c]);
+    tiles = mt.tiles;
+    attrs = mt.attrs;
+
+    for (i = 0; i < (uint8_t)(cell_size * cell_size); i++) {
+        /* Picture tiles have their sprite copies in VRAM bank 1 */
+        if (attrs[i] & ATTR_BANK1) {
+            set_sprite_tile(SPR_SLIDE + i, PIC_SPRITE(tiles[i]));
+        } else {
+            set_sprite_tile(SPR_SLIDE + i, SPR_T_PUZZLE + tiles[i]);
+        }
+        /* CGB palette in bits 0-2 and the VRAM bank in bit 3 (the same
+           bits as in the BG attributes), S_PALETTE selects OBP1 on DMG */
+        set_sprite_prop(SPR_SLIDE + i, attrs[i] | S_PALETTE);
+    }
+
+    slide_px = CELL_PX(from_c);
+    slide_py = CELL_PY(from_r);
+    slide_dx = (int8_t)to_c - (int8_t)from_c;
+    slide_dy = (int8_t)to_r - (int8_t)from_r;
+    slide_row = to_r;
+    slide_col = to_c;
+    slide_frame = 1;
+    place_slide();
+}
+
+/* Called once per frame. Returns 1 on the frame the slide commits. */
+uint8_t update_slide(void) {
+    uint8_t i;
+
+    if (slide_frame == 0) return 0;
+
+    if (slide_frame < SLIDE_FRAMES) {
+        slide_frame++;
+        place_slide();
+        return 0;
+    }
+
+    /* Commit: the BG cell and the hidden sprites land in the same VBlank */
+    draw_cell(slide_col, slide_row);
+    for (i = 0; i < (uint8_t)(cell_size * cell_size); i++) {
+        move_sprite(SPR_SLIDE + i, 0, 0);
+    }
+    slide_frame = 0;
+    return 1;
+}
+
+/* ======== Themes ======== */
+
+/* Every theme draws the same logical tiles (the T_ constants), so a
+   switch only reloads tile data and the CGB translation */
+typedef struct {
+    const uint8_t *tiles;       /* logical set: DMG BG and sliding sprites */
+    const uint8_t *tiles_cgb;   /* deduplicated under flip: CGB BG */
+    uint8_t cgb_set;            /* bit of tiles_cgb in cgb_loaded */
+    const uint8_t *ids;         /* CGB translation for render_tile_remap */
+    const uint8_t *attrs;
+    uint8_t picture;            /* cells show the picture (CGB only) */
+} theme_t;
+
+#define THEME_COUNT  3
+
+static const theme_t themes[THEME_COUNT] = {
+    { puzzle_tiles, puzzle_tiles_cgb, 0x01, puzzle_tile_ids, puzzle_tile_attrs, 0 },
+    { round_tiles,  round_tiles_cgb,  0x02, round_tile_ids,  round_tile_attrs,  0 },
+    { puzzle_tiles, puzzle_tiles_cgb, 0x01, puzzle_tile_ids, puzzle_tile_attrs, 1 },
+};
+
+/* CGB sets in VRAM, one bit per set (themes sharing a set share its
+   bit). Each CGB set has its own slots in the VRAM layout (see the
+   Makefile), so it is loaded once and stays. */
+static uint8_t cgb_loaded;
+
+/* Stream theme t into VRAM: a frame per chunk with the display on, all
+   at once with it off. Maps drawn with the old theme must be redrawn
+   on CGB, where the translation changes. */
+void load_theme(uint8_t t) {
+    const theme_t *th = &themes[t];
+
+    if (_cpu == CGB_TYPE) {
+        if (!(cgb_loaded & th->cgb_set)) {
+            tileset_load_bkg(0, th->tiles_cgb);
+            cgb_loaded |= th->cgb_set;
+        }
     } else {
-        /* Restore normal palette */
-        uint8_t pal = get_tile_palette(board[gy][gx]);
-        set_bkg_tile_xy(sx, sy, pal);
-        set_bkg_tile_xy(sx + 2, sy, pal);
-        set_bkg_tile_xy(sx, sy + 2, pal);
-        set_bkg_tile_xy(sx + 2, sy + 2, pal);
+        tileset_load_bkg(0, th->tiles);
+    }
+    tileset_load_opaque(SPR_T_PUZZLE, th->tiles);
+    render_tile_remap(th->ids, th->attrs, PUZZLE_TILES_COUNT);
+
+    cell_picture = 0;
+    if (th->picture) {
+        picture_load();
+        cell_picture = 1;
+    }
+}
+
+/* ======== Number Tiles ======== */
+
+/* Compose a center tile for each number from 10 up: the tens and ones
+   glyphs of the 3x5 digit font side by side, one column apart, on rows
+   2-6 like the hand-drawn digits. The tiles are built as 1bpp and go
+   to the BG tiles in color 3 on 0 and to the sliding sprites in color 3
+   on 1, as tileset_load_opaque would load them. Grids up to 8x8 stop at
+   63, so two digits always do; all of them are made up front so no
+   board size has to wait for its tiles. */
+void init_numbers(void) {
+    uint8_t buf[8];
+    uint8_t n, r;
+
+    for (n = 10; n < TILES_MAX; n++) {
+        const uint8_t *tens = digit_font[n / 10];
+        const uint8_t *ones = digit_font[n % 10];
+#ifdef RENDER_STATS
+        uint8_t start = DIV_REG;
+        uint8_t ticks;
+#endif
+
+        for (r = 0; r < 8; r++) {
+            uint8_t bits = 0;
+            if (r >= 2 && r < 7) {
+                bits = (tens[r - 2] >> 1) | (ones[r - 2] >> 5);
+            }
+            buf[r] = bits;
+        }
+        set_1bpp_colors(3, 0);
+        set_bkg_1bpp_data(T_NUMBERS + n - 10, 1, buf);
+        set_1bpp_colors(3, 1);
+        set_sprite_1bpp_data(SPR_T_PUZZLE + T_NUMBERS + n - 10, 1, buf);
+
+#ifdef RENDER_STATS
+        ticks = DIV_REG - start;
+        if (ticks > render_stats.tile_ticks) render_stats.tile_ticks = ticks;
+#endif
     }
-    VBK_REG = 0;
 }
 
 /* ======== Puzzle Logic ======== */
 
+/* Switch to an n x n board: pick the cell size, place the board in the
+   map and set the camera limits, the row palettes and the slide easing.
+   Cells are the largest size that fits the board on screen, or 3x3
+   while zoomed in. Along an axis where the board fits the screen it is
+   centered (vertically a row low if there is room, where the 4x4 board
+   has always been) and never scrolls. Otherwise it starts one blank
+   tile in from the map edge and the camera can scroll to one blank
+   tile past its far border. */
+void set_grid_size(uint8_t n) {
+    uint8_t size = CELL_MAX;
+    uint8_t span, x, y, i, v;
+
+    if (!zoomed) {
+        while (size > CELL_MIN &&
+               (BOARD_SPAN(n, size) > VIEW_W || BOARD_SPAN(n, size) > VIEW_H)) {
+            size--;
+        }
+    }
+    span = BOARD_SPAN(n, size);
+
+    grid_size = n;
+    total_tiles = n * n;
+    cell_size = size;
+
+    /* Content ends one blank tile past the border */
+    if (span <= VIEW_W) {
+        x = (VIEW_W - span) / 2 + 1;
+        camera_max_x = 0;
+    } else {
+        x = 2;
+        camera_max_x = (span + 2 - VIEW_W) * 8;
+    }
+    if (span <= VIEW_H) {
+        y = (VIEW_H - span) / 2 + 2;
+        if (y > VIEW_H - span + 1) y = VIEW_H - span + 1;
+        camera_max_y = 0;
+    } else {
+        y = 2;
+        camera_max_y = (span + 2 - VIEW_H) * 8;
+    }
+    for (i = 0; i < n; i++) {
+        cell_mx[i] = x;
+        cell_my[i] = y;
+        x += size;
+        y += size;
+    }
+
+    cell_pal[EMPTY_TILE] = 5;
+    for (v = 1; v < total_tiles; v++) {
+        cell_pal[v] = 1 + (((v - 1) / n) & 3);
+    }
+
+    init_easing();
+}
+
+/* Switch between 3x3 cells and the compact ones the board fits on
+   screen with, redrawing it in the hidden map and flipping to it. The
+   camera jumps to the cursor. Boards that fit with 3x3 cells anyway
+   stay as they are. */
+void toggle_zoom(void) {
+    uint8_t size = cell_size;
+
+    zoomed ^= 1;
+    set_grid_size(grid_size);
+    if (cell_size == size) return;
+
+    camera_x = camera_target(0, CELL_PX(cursor_col), VIEW_W * 8, camera_max_x);
+    camera_y = camera_target(0, CELL_PY(cursor_row), VIEW_H * 8, camera_max_y);
+
+    render_target(render_back());
+    render_fill_rect(0, 0, MAP_W, MAP_H, T_BLANK, 0);
+    draw_border();
+    draw_board();
+    render_flush();
+    show_cursor();
+    render_scroll(camera_x, camera_y);
+    render_show(render_back());
+}
+
 /* Check if the puzzle is solved */
 uint8_t check_win(void) {
     uint8_t expected = 1;
     uint8_t r, c_idx;
-    for (r = 0; r < GRID_SIZE; r++) {
-        for (c_idx = 0; c_idx < GRID_SIZE; c_idx++) {
-            if (r == GRID_SIZE - 1 && c_idx == GRID_SIZE - 1) {
+    for (r = 0; r < grid_size; r++) {
+        for (c_idx = 0; c_idx < grid_size; c_idx++) {
+            if (r == grid_size - 1 && c_idx == grid_size - 1) {
                 /* Last cell should be empty */
                 if (board[r][c_idx] != EMPTY_TILE) return 0;
             } else {
@@ -352,17 +937,18 @@ uint8_t try_move(uint8_t from_r, uint8_t from_c) {
         board[empty_row][empty_col] = board[from_r][from_c];
         board[from_r][from_c] = EMPTY_TILE;
 
-        /* Redraw affected cells */
+        /* The old cell shows empty right away, the tile slides as sprites */
         uint8_t old_er = empty_row;
         uint8_t old_ec = empty_col;
         empty_row = from_r;
         empty_col = from_c;
 
-        draw_cell(old_ec, old_er);
         draw_cell(empty_col, empty_row);
+        start_slide(from_r, from_c, old_er, old_ec);
 
-        move_count++;
-        draw_hud();
+        /* Redraw only the digits the increment changed */
+        uint8_t changed = bump_moves();
+        if (changed) draw_moves(changed);
 
         return 1;
     }
@@ -373,27 +959,29 @@ uint8_t try_move(uint8_t from_r, uint8_t from_c) {
 void init_board(void) {
     uint8_t r, c_idx;
     uint8_t val = 1;
-    for (r = 0; r < GRID_SIZE; r++) {
-        for (c_idx = 0; c_idx < GRID_SIZE; c_idx++) {
-            if (r == GRID_SIZE - 1 && c_idx == GRID_SIZE - 1) {
+    for (r = 0; r < grid_size; r++) {
+        for (c_idx = 0; c_idx < grid_size; c_idx++) {
+            if (r == grid_size - 1 && c_idx == grid_size - 1) {
                 board[r][c_idx] = EMPTY_TILE;
             } else {
                 board[r][c_idx] = val++;
             }
         }
     }
-    empty_row = GRID_SIZE - 1;
-    empty_col = GRID_SIZE - 1;
+    empty_row = grid_size - 1;
+    empty_col = grid_size - 1;
 }
 
-/* Shuffle the board by making random valid moves */
+/* Shuffle the board by making random valid moves, 200 on the 4x4 board
+   and more in proportion to the tile count on bigger ones */
 void shuffle_board(void) {
-    uint8_t i;
+    uint16_t i;
+    uint16_t moves = (uint16_t)total_tiles * 25 / 2;
     uint8_t last_dir = 0xFF;
 
     initrand(seed_counter);
 
-    for (i = 0; i < 200; i++) {
+    for (i = 0; i < moves; i++) {
         uint8_t dir = ((uint8_t)rand()) & 0x03;
 
         /* Don't undo the previous move */
@@ -409,7 +997,7 @@ void shuffle_board(void) {
                 }
                 break;
             case 1: /* From below */
-                if (empty_row < GRID_SIZE - 1) {
+                if (empty_row < grid_size - 1) {
                     board[empty_row][empty_col] = board[empty_row + 1][empty_col];
                     board[empty_row + 1][empty_col] = EMPTY_TILE;
                     empty_row++;
@@ -425,7 +1013,7 @@ void shuffle_board(void) {
                 }
                 break;
             case 3: /* From right */
-                if (empty_col < GRID_SIZE - 1) {
+                if (empty_col < grid_size - 1) {
                     board[empty_row][empty_col] = board[empty_row][empty_col + 1];
                     board[empty_row][empty_col + 1] = EMPTY_TILE;
                     empty_col++;
@@ -436,98 +1024,152 @@ void shuffle_board(void) {
     }
 }
 
-/* Flash all tiles gold when the player wins */
-void win_animation(void) {
-    uint8_t i, gx, gy;
-
-    for (i = 0; i < 6; i++) {
-        /* Flash all cells to gold palette */
-        VBK_REG = 1;
-        for (gy = 0; gy < GRID_SIZE; gy++) {
-            for (gx = 0; gx < GRID_SIZE; gx++) {
-                uint8_t sx = GRID_X + gx * CELL_W;
-                uint8_t sy = GRID_Y + gy * CELL_H;
-                uint8_t pal = (i & 1) ? get_tile_palette(board[gy][gx]) : 6;
-                uint8_t r, c_idx;
-                for (r = 0; r < CELL_H; r++) {
-                    for (c_idx = 0; c_idx < CELL_W; c_idx++) {
-                        set_bkg_tile_xy(sx + c_idx, sy + r, pal);
-                    }
-                }
-            }
+/* Blend one 5-bit color channel from a toward b by step / WIN_FADE_STEPS */
+uint8_t blend_channel(uint8_t a, uint8_t b, uint8_t step) {
+    int16_t d = (int16_t)b - (int16_t)a;
+    return (uint8_t)(a + d * step / WIN_FADE_STEPS);
+}
+
+/* Precompute the win fade: every color of palettes 1-5 blended toward
+   the matching color of the gold palette 6. A DMG has no color
+   palettes, so there the four BGP shades fade toward their inverse. */
+void init_win_fade(void) {
+    const uint16_t *gold = &bg_palettes[6 * 4];
+    uint8_t step, i;
+
+    for (step = 0; step <= WIN_FADE_STEPS; step++) {
+        uint8_t bgp = 0;
+        for (i = 0; i < 4; i++) {
+            bgp |= blend_channel(i, 3 - i, step) << (i * 2);
         }
-        VBK_REG = 0;
+        win_fade_bgp[step] = bgp;
+
+        for (i = 0; i < WIN_PAL_COUNT * 4; i++) {
+            uint16_t from = bg_palettes[WIN_PAL_FIRST * 4 + i];
+            uint16_t to = gold[i & 3];
+            win_fade[step][i] = RGB(blend_channel(from & 0x1F, to & 0x1F, step),
+                                    blend_channel((from >> 5) & 0x1F, (to >> 5) & 0x1F, step),
+                                    blend_channel((from >> 10) & 0x1F, (to >> 10) & 0x1F, step));
+        }
+    }
+}
 
-        /* Wait ~20 frames */
-        uint8_t f;
-        for (f = 0; f < 20; f++) {
+/* Show one fade step for the tile palettes, right after VBlank starts */
+void show_win_fade(uint8_t step) {
+    wait_vbl_done();
+    if (_cpu == CGB_TYPE) {
+        set_bkg_palette(WIN_PAL_FIRST, WIN_PAL_COUNT, win_fade[step]);
+    } else {
+        BGP_REG = win_fade_bgp[step];
+    }
+}
+
+/* Flash all tiles gold when the player wins. Only palette RAM changes,
+   the attribute map is never touched. */
+void win_animation(void) {
+    uint8_t i, step, f;
+
+    for (i = 0; i < WIN_PULSES; i++) {
+        for (step = 1; step <= WIN_FADE_STEPS; step++) {
+            show_win_fade(step);
+        }
+        for (f = 0; f < WIN_HOLD; f++) {
+            wait_vbl_done();
+        }
+        for (step = WIN_FADE_STEPS; step > 0; step--) {
+            show_win_fade(step - 1);
+        }
+        for (f = 0; f < WIN_HOLD; f++) {
             wait_vbl_done();
         }
     }
 }
 
-/* Title screen - wait for START and accumulate random seed */
-void title_screen(void) {
-    /* Clear screen */
-    uint8_t x, y;
-    for (y = 0; y < 18; y++) {
-        for (x = 0; x < 20; x++) {
-            set_bkg_tile_xy(x, y, T_BLANK);
+/* Write the logo for the current board size over the title map: the
+   number of tiles, tens and ones a tile apart like the "15" in it */
+void draw_logo(void) {
+    uint8_t n = total_tiles - 1;
+
+    render_locate(LOGO_X, LOGO_Y);
+    render_repeat(1, char_tile('0' + n / 10), 7);
+    render_skip(1);
+    render_repeat(1, char_tile('0' + n % 10), 7);
+}
+
+/* Prebuilt border, "15" logo and puzzle icon, one unpack per map, then
+   the logo for the board size picked */
+void draw_title(void) {
+    render_attrs_rle(title_map_attrs);
+    render_tiles_rle(title_map_tiles);
+    draw_logo();
+    render_flush();
+}
+
+/* Step the board size on the title screen by one, within GRID_MIN to
+   GRID_MAX. The picture only comes in PIC_GRID x PIC_GRID. */
+void step_grid_size(int8_t d) {
+    uint8_t n = grid_size + d;
+
+    if (themes[theme].picture || n < GRID_MIN || n > GRID_MAX) return;
+    set_grid_size(n);
+    draw_logo();
+}
+
+/* Switch to the next theme on the title screen. The BG is blanked
+   while the tiles stream in and the title is redrawn, so half-loaded
+   tiles and half-translated rows never show. */
+void next_theme(void) {
+    uint8_t p, c;
+
+    /* The DMG has no second VRAM bank for the picture */
+    do {
+        theme = (theme + 1) % THEME_COUNT;
+    } while (themes[theme].picture && _cpu != CGB_TYPE);
+
+    if (_cpu == CGB_TYPE) {
+        for (p = 0; p < 8; p++) {
+            for (c = 0; c < 4; c++) {
+                set_bkg_palette_entry(p, c, RGB_WHITE);
+            }
         }
+    } else {
+        BGP_REG = 0x00;
     }
 
-    /* Set palette for title */
-    VBK_REG = 1;
-    for (y = 0; y < 18; y++) {
-        for (x = 0; x < 20; x++) {
-            set_bkg_tile_xy(x, y, 7);
-        }
+    load_theme(theme);
+    if (themes[theme].picture) {
+        set_grid_size(PIC_GRID);
     }
-    VBK_REG = 0;
-
-    /* Draw "15" in large tiles in center */
-    /* "1" */
-    set_bkg_tile_xy(7, 5, T_NUM_START);   /* tile for "1" */
-    /* "5" */
-    set_bkg_tile_xy(9, 5, T_NUM_START + 4); /* tile for "5" */
-
-    /* Draw a small puzzle icon */
-    set_bkg_tile_xy(7, 7, T_TILE_TL);
-    set_bkg_tile_xy(8, 7, T_TILE_T);
-    set_bkg_tile_xy(9, 7, T_TILE_T);
-    set_bkg_tile_xy(10, 7, T_TILE_TR);
-
-    set_bkg_tile_xy(7, 8, T_TILE_L);
-    set_bkg_tile_xy(8, 8, T_NUM_START + 0);  /* "1" */
-    set_bkg_tile_xy(9, 8, T_NUM_START + 1);  /* "2" */
-    set_bkg_tile_xy(10, 8, T_TILE_R);
-
-    set_bkg_tile_xy(7, 9, T_TILE_L);
-    set_bkg_tile_xy(8, 9, T_NUM_START + 2);  /* "3" */
-    set_bkg_tile_xy(9, 9, T_EMPTY_CELL);     /* empty */
-    set_bkg_tile_xy(10, 9, T_TILE_R);
-
-    set_bkg_tile_xy(7, 10, T_TILE_BL);
-    set_bkg_tile_xy(8, 10, T_TILE_B);
-    set_bkg_tile_xy(9, 10, T_TILE_B);
-    set_bkg_tile_xy(10, 10, T_TILE_BR);
-
-    /* Color the puzzle icon */
-    VBK_REG = 1;
-    set_bkg_tile_xy(8, 8, 1);  /* blue */
-    set_bkg_tile_xy(9, 8, 2);  /* green */
-    set_bkg_tile_xy(8, 9, 3);  /* orange */
-    set_bkg_tile_xy(9, 9, 5);  /* dark (empty) */
-    VBK_REG = 0;
+    draw_title();
 
+    wait_vbl_done();
+    if (_cpu == CGB_TYPE) {
+        set_bkg_palette(0, 8, bg_palettes);
+    } else {
+        BGP_REG = win_fade_bgp[0];
+    }
+}
+
+/* Title screen - wait for START and accumulate random seed. SELECT
+   cycles through the themes, LEFT and RIGHT change the board size. */
+void title_screen(void) {
+    uint8_t keys, prev = 0;
+
+    draw_title();
     SHOW_BKG;
+    DISPLAY_ON;
 
     /* Wait for START, accumulating randomness */
     seed_counter = 0;
     while (1) {
         wait_vbl_done();
         seed_counter++;
-        if (joypad() & J_START) break;
+        keys = joypad();
+        if (keys & J_START) break;
+        if (keys & ~prev & J_SELECT) next_theme();
+        if (keys & ~prev & J_LEFT) step_grid_size(-1);
+        if (keys & ~prev & J_RIGHT) step_grid_size(1);
+        prev = keys;
     }
 
     /* Wait for button release */
@@ -536,6 +1178,32 @@ void title_screen(void) {
     }
 }
 
+/* Reset the game state, shuffle a new board and draw it into the map
+   that is not on screen; the caller flips to it with render_show.
+   The HUD is not double-buffered and is redrawn at the flip. */
+void prepare_game(void) {
+    move_bcd[0] = 0;
+    move_bcd[1] = 0;
+    move_bcd[2] = 0;
+    game_won = 0;
+    cursor_row = 0;
+    cursor_col = 0;
+    input_cooldown = 0;
+    move_buffered = 0;
+
+    init_board();
+    shuffle_board();
+
+    /* A new board starts scrolled to its top-left corner */
+    camera_x = 0;
+    camera_y = 0;
+
+    render_target(render_back());
+    render_fill_rect(0, 0, MAP_W, MAP_H, T_BLANK, 0);
+    draw_border();
+    draw_board();
+}
+
 /* ======== Main Entry Point ======== */
 
 void main(void) {
@@ -546,55 +1214,61 @@ void main(void) {
 
     DISPLAY_OFF;
 
-    /* Load tile data into VRAM */
-    set_bkg_data(0, PUZZLE_TILES_COUNT, puzzle_tiles);
-
     /* Set CGB palettes */
     set_bkg_palette(0, 8, bg_palettes);
 
-    SHOW_BKG;
-    DISPLAY_ON;
+    /* Route all map writes through the shadow map, uploaded in VBlank */
+    render_init();
+
+    /* Load the first theme's tiles: on CGB the set deduplicated under
+       flip, which the renderer maps logical tiles onto */
+    load_theme(0);
 
-    /* Show title screen */
+    /* Board size until one is picked on the title screen */
+    set_grid_size(GRID_MIN);
+
+    /* Cursor corner sprites and the sliding tile sprites */
+    init_cursor();
+    init_slide();
+    init_numbers();
+    init_win_fade();
+
+    /* Show title screen (turns the display on once drawn) */
     title_screen();
 
+    /* The first board is drawn into the hidden map behind the title */
+    prepare_game();
+
     /* Start new game loop */
     while (1) {
-        DISPLAY_OFF;
-
-        /* Initialize game state */
-        move_count = 0;
-        game_won = 0;
-        cursor_row = 0;
-        cursor_col = 0;
-        input_cooldown = 0;
-
-        /* Set up the board */
-        init_board();
-        shuffle_board();
-
-        /* Clear the screen */
-        uint8_t cx, cy;
-        for (cy = 0; cy < 18; cy++) {
-            for (cx = 0; cx < 20; cx++) {
-                set_bkg_tile_xy(cx, cy, T_BLANK);
-                VBK_REG = 1;
-                set_bkg_tile_xy(cx, cy, 0);
-                VBK_REG = 0;
-            }
-        }
-
-        /* Draw game elements */
-        draw_border();
-        draw_board();
+        /* Flip to the prepared board; the cursor, the scroll and the
+           reset move counter go up in the same VBlank */
+        render_flush();
+        show_cursor();
         draw_hud();
-        draw_cursor(cursor_col, cursor_row, 1);
-
-        DISPLAY_ON;
+        render_scroll(camera_x, camera_y);
+        render_show(render_back());
+        SHOW_WIN;
 
         /* ======== Game Loop ======== */
         while (!game_won) {
             wait_vbl_done();
+            seed_counter++;
+            update_cursor(update_camera());
+
+            /* Check for win once the last slide has landed */
+            if (update_slide() && check_win()) {
+                game_won = 1;
+                break;
+            }
+
+            /* Run a move that was pressed during the previous slide */
+            if (move_buffered && slide_frame == 0) {
+                move_buffered = 0;
+                if (board[cursor_row][cursor_col] != EMPTY_TILE) {
+                    try_move(cursor_row, cursor_col);
+                }
+            }
 
             if (input_cooldown > 0) {
                 input_cooldown--;
@@ -604,62 +1278,57 @@ void main(void) {
             uint8_t keys = joypad();
 
             if (keys & (J_UP | J_DOWN | J_LEFT | J_RIGHT)) {
-                /* Erase old cursor */
-                draw_cursor(cursor_col, cursor_row, 0);
-
-                uint8_t old_row = cursor_row;
-                uint8_t old_col = cursor_col;
-
                 if ((keys & J_UP) && cursor_row > 0) {
                     cursor_row--;
                 }
-                if ((keys & J_DOWN) && cursor_row < GRID_SIZE - 1) {
+                if ((keys & J_DOWN) && cursor_row < grid_size - 1) {
                     cursor_row++;
                 }
                 if ((keys & J_LEFT) && cursor_col > 0) {
                     cursor_col--;
                 }
-                if ((keys & J_RIGHT) && cursor_col < GRID_SIZE - 1) {
+                if ((keys & J_RIGHT) && cursor_col < grid_size - 1) {
                     cursor_col++;
                 }
 
-                /* Draw new cursor */
-                draw_cursor(cursor_col, cursor_row, 1);
+                /* The cursor sprites glide there in update_cursor */
                 input_cooldown = INPUT_DELAY;
             }
 
             if (keys & J_A) {
-                /* Try to slide the selected tile into the empty space */
-                if (board[cursor_row][cursor_col] != EMPTY_TILE) {
-                    if (try_move(cursor_row, cursor_col)) {
-                        /* Redraw cursor at current position */
-                        draw_cursor(cursor_col, cursor_row, 1);
-
-                        /* Check for win */
-                        if (check_win()) {
-                            game_won = 1;
-                        }
-                    }
+                /* Try to slide the selected tile into the empty space,
+                   or remember the press if a slide is still running */
+                if (slide_frame) {
+                    move_buffered = 1;
+                } else if (board[cursor_row][cursor_col] != EMPTY_TILE) {
+                    try_move(cursor_row, cursor_col);
                 }
                 input_cooldown = INPUT_DELAY;
             }
 
+            /* B: zoom in to 3x3 cells and scroll, or back out to cells
+               that fit the board on screen */
+            if ((keys & J_B) && slide_frame == 0) {
+                toggle_zoom();
+                input_cooldown = INPUT_DELAY;
+            }
+
             /* SELECT: auto-slide - push tile toward empty if possible */
             if (keys & J_SELECT) {
                 /* Quick move: if cursor is on a tile adjacent to empty, slide it */
-                if (board[cursor_row][cursor_col] != EMPTY_TILE) {
-                    if (try_move(cursor_row, cursor_col)) {
-                        draw_cursor(cursor_col, cursor_row, 1);
-                        if (check_win()) {
-                            game_won = 1;
-                        }
-                    }
+                if (slide_frame) {
+                    move_buffered = 1;
+                } else if (board[cursor_row][cursor_col] != EMPTY_TILE) {
+                    try_move(cursor_row, cursor_col);
                 }
                 input_cooldown = INPUT_DELAY;
             }
         }
 
-        /* Win! */
+        /* Win! The next board is built in the hidden map while the
+           finished one flashes */
+        hide_cursor();
+        prepare_game();
         win_animation();
 
         /* Wait for START to play again */
@@ -0,0 +1,73 @@
+/*
+ * Picture puzzle tiles (CGB only)
+ *
+ * The data is copied straight from its ROM bank with the CGB's VRAM
+ * DMA, 16 bytes per HBlank with the display on or in one general
+ * purpose burst with it off. DMA ignores the low four address bits of
+ * the source, so an array the linker did not place on a 16-byte
+ * boundary is copied by the CPU instead.
+ */
+
+#include <gb/gb.h>
+#include <gb/cgb.h>
+#include <stdint.h>
+
+#include "picture.h"
+#include "render.h"
+
+BANKREF_EXTERN(picture_tiles)
+extern const uint8_t picture_tiles[];
+extern const uint8_t picture_sprites[];
+
+#define BKG_LOW_BASE   0x9000   /* BG tiles 0-127 */
+#define SHARED_BASE    0x8800   /* BG tiles 128-255 */
+#define SPRITE_BASE    0x8000   /* Sprite tiles 0-255 */
+
+/* One DMA transfer moves at most 128 blocks of 16 bytes */
+#define DMA_MAX_BLOCKS 128
+
+/* Copy blocks 16-byte blocks from src to VRAM dst in the current ROM and
+   VRAM banks */
+static void copy_blocks(uint16_t dst, const uint8_t *src, uint8_t blocks) {
+    if ((uint16_t)src & 0x0F) {
+        set_data((uint8_t *)dst, src, (uint16_t)blocks << 4);
+        return;
+    }
+
+    HDMA1_REG = (uint8_t)((uint16_t)src >> 8);
+    HDMA2_REG = (uint8_t)(uint16_t)src;
+    HDMA3_REG = (uint8_t)(dst >> 8);
+    HDMA4_REG = (uint8_t)dst;
+    if (LCDC_REG & LCDCF_ON) {
+        HDMA5_REG = 0x80 | (blocks - 1);
+        /* Bit 7 reads back set once the last block is done */
+        while (!(HDMA5_REG & 0x80));
+    } else {
+        HDMA5_REG = blocks - 1;
+    }
+}
+
+/* Copy a 135-tile array as its first 128 tiles to low and the rest to
+   high */
+static void copy_tiles(uint16_t low, uint16_t high, const uint8_t *src) {
+    copy_blocks(low, src, DMA_MAX_BLOCKS);
+    copy_blocks(high, src + DMA_MAX_BLOCKS * 16, PIC_TILES - DMA_MAX_BLOCKS);
+}
+
+void picture_load(void) {
+    uint8_t save = CURRENT_BANK;
+
+    /* A GDMA from the renderer's VBL handler would cancel an HBlank
+       transfer partway, so everything queued goes up first. Nothing
+       is drawn until this returns. */
+    render_flush();
+
+    SWITCH_ROM(BANK(picture_tiles));
+    VBK_REG = 1;
+
+    copy_tiles(BKG_LOW_BASE, SHARED_BASE, picture_tiles);
+    copy_tiles(SPRITE_BASE, SPRITE_BASE + PIC_SPRITE(128) * 16, picture_sprites);
+
+    VBK_REG = 0;
+    SWITCH_ROM(save);
+}
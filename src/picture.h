@@ -0,0 +1,35 @@
+/*
+ * Picture puzzle tiles (CGB only)
+ *
+ * In picture mode each numbered cell shows its 3x3 slice of an image
+ * (res/picture.png) instead of a number. The 135 slice tiles and their
+ * opaque sprite copies sit uncompressed in a ROM bank and go to VRAM
+ * bank 1 by DMA once, when the mode is picked. Cells are drawn with
+ * ATTR_BANK1 on top of the usual cell palettes, so a move only changes
+ * tile numbers in the map, exactly like a numbered move.
+ */
+
+#ifndef PICTURE_H
+#define PICTURE_H
+
+#include <stdint.h>
+
+/* The picture is cut for a 4x4 board */
+#define PIC_GRID   4
+#define PIC_CELLS  (PIC_GRID * PIC_GRID - 1)
+#define PIC_TILES  (PIC_CELLS * 9)
+
+/* Cell n's BG tile i (row-major, 0-8), drawn with ATTR_BANK1 */
+#define PIC_TILE(n, i)  (((n) - 1) * 9 + (i))
+
+/* BG tiles 0-127 sit at 0x9000 and 128 up at 0x8800. The sprite copies
+   fill sprite tiles 0-127 (0x8000) and carry on past the BG tiles in
+   the block at 0x8800 that both share. */
+#define PIC_SPRITE(t)   ((t) < 128 ? (t) : (t) + (PIC_TILES - 128))
+
+/* Copy the picture tiles and sprite copies to VRAM bank 1. With the
+   display on this flushes the renderer, whose VBlank DMA would cancel
+   the transfer, then uses HBlank DMA and blocks for about two frames. */
+void picture_load(void);
+
+#endif
@@ -0,0 +1,796 @@
+/*
+ * Shadow-map renderer for the sliding puzzle
+ *
+ * Each of the two BG maps (0x9800 and 0x9C00) has its own shadow:
+ * MAP_H rows of the tile map followed by the same rows of the attribute
+ * map, laid out exactly like VRAM (32 bytes per row). Drawing only
+ * touches the shadow of the target map and sets its row_dirty[] bits;
+ * the VBL handler clears a row's bits before uploading it, so a write
+ * that races the upload simply re-marks the row for the next frame.
+ * The bits track each 16-column half of a row separately for the tile
+ * and attribute maps, and metatile draws compare against the shadow
+ * and only mark the halves where a byte really changed, so redrawing a
+ * cell uploads just the parts that differ.
+ * The map on screen is uploaded first, starting from the rows in view,
+ * and the hidden one gets what is left of the VBlank.
+ *
+ * The HUD lives on the Window layer, drawn from rows 0-1 of 0x9C00. To
+ * keep those rows free, the shadows hold map rows BG_ROW0-31 and SCY
+ * always adds BG_ROW0 rows to the scroll position, so the screen never
+ * reaches the HUD rows. The HUD has a separate small shadow whose
+ * written rows go up, before any map rows, in the next VBlank.
+ *
+ * On CGB, runs of consecutive dirty rows go up as one general-purpose
+ * DMA burst per map bank. DMG has no HDMA, so rows are copied by the CPU
+ * with a STAT-checked writer, which stays correct even if the VBL
+ * handler starts late and the copy runs into the visible frame.
+ *
+ * A DMG has no attribute map and no VRAM bank register. render_init
+ * picks a DMG metatile blitter that never touches the attribute shadow,
+ * and the other writers and the upload code skip attributes and VBK_REG
+ * when render_cgb is clear.
+ *
+ * VBlank alone cannot carry a whole screen per frame, so an LYC
+ * interrupt near the bottom of the visible frame also streams the
+ * hidden map through the STAT-checked writer (on both models), using
+ * the HBlank and OAM-scan part of every remaining line. The map on
+ * screen is left to VBlank so it never changes mid-frame.
+ */
+
+#include <gb/gb.h>
+#include <gb/cgb.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "render.h"
+
+/* ======== Constants ======== */
+
+#define MAP_BASE      0x9800
+#define MAP_BYTES     0x0400   /* 0x9C00 - 0x9800 */
+#define SHADOW_SIZE   (MAP_W * MAP_H)
+
+/* First map row of BG content; the rows above hold the window HUD */
+#define BG_ROW0       HUD_H
+#define HUD_BASE      (MAP_BASE + MAP_BYTES)
+#define HUD_SIZE      (MAP_W * HUD_H)
+
+/* VBlank spans LY 144-153. Uploads stop once LY reaches this line so the
+   last write never spills into the next visible frame. Measuring the
+   budget in scanlines keeps it correct at both CPU speeds. */
+#define FLUSH_LAST_LINE  150
+
+/* Longest single DMA burst in rows (2 x 16-byte blocks per row per bank),
+   keeps each burst well under a scanline pair so the LY check stays useful.
+   With the LCD off there is no budget and a whole map goes in one burst. */
+#define DMA_MAX_ROWS  6
+
+/* HBlank streaming runs from this line (the LYC interrupt). Lines above
+   are left to game code. */
+#define STREAM_FIRST_LINE  96
+
+/* The STAT-checked writer takes 17 M-cycles per byte and only starts a
+   byte while it sees mode 0, which can be as short as about 22 M-cycles
+   on DMG and 43 in CGB double speed once sprites and fine scrolling
+   stretch mode 3. That leaves 1 byte a line on DMG and 2 on CGB in the
+   worst case. CPU uploads check the time before each 16-byte half row,
+   so streaming stops one worst-case half row before line 144 and never
+   holds off the VBL interrupt. */
+#define STREAM_LAST_LINE(bytes_per_line)  (144 - 16 / (bytes_per_line))
+#define STREAM_LAST_LINE_DMG  STREAM_LAST_LINE(1)
+#define STREAM_LAST_LINE_CGB  STREAM_LAST_LINE(2)
+
+/* flush_map modes: no time limit (LCD off), the rest of VBlank, or
+   visible lines via the STAT-checked writer */
+#define FLUSH_ALL     0
+#define FLUSH_VBLANK  1
+#define FLUSH_HBLANK  2
+
+/* ======== Shadow State ======== */
+
+/* GDMA sources must be 16-byte aligned, so the shadows are carved out
+   of an oversized buffer at startup */
+static uint8_t shadow_raw[(RENDER_MAPS * SHADOW_SIZE + HUD_SIZE) * 2 + 15];
+static uint8_t *shadow_tiles[RENDER_MAPS];
+static uint8_t *shadow_attrs[RENDER_MAPS];
+static uint8_t *hud_tiles;
+static uint8_t *hud_attrs;
+
+/* row_dirty bits: columns 0-15 and 16-31 of the tile map, then the
+   same two halves of the attribute map */
+#define DIRTY_TILES   0x03
+#define DIRTY_ATTRS   0x0C
+#define DIRTY_ROW     (DIRTY_TILES | DIRTY_ATTRS)
+
+static volatile uint8_t row_dirty[RENDER_MAPS][MAP_H];
+static volatile uint8_t hud_dirty;  /* one bit per HUD row */
+
+/* Shadow of the map that drawing goes to */
+static uint8_t *tgt_tiles;
+static uint8_t *tgt_attrs;
+static volatile uint8_t *tgt_dirty;
+
+/* Map on screen, and the map to flip to once it is uploaded (or NO_SHOW) */
+#define NO_SHOW  0xFF
+static uint8_t shown_map;
+static volatile uint8_t show_pending = NO_SHOW;
+
+/* Scroll position set by render_scroll, loaded into SCX/SCY by the VBL
+   handler, and the shadow row at the top of the screen */
+static volatile uint8_t scroll_x, scroll_y;
+static volatile uint8_t view_row;
+
+static uint8_t render_cgb;
+static uint8_t stream_last_line;  /* STREAM_LAST_LINE_DMG or _CGB */
+
+/* CGB tile translation set by render_tile_remap; tiles from
+   remap_count up and tiles drawn with ATTR_BANK1 go through as given */
+static const uint8_t *remap_ids;
+static const uint8_t *remap_attrs;
+static uint8_t remap_count;
+
+#define REMAPPED(t, a)    ((t) < remap_count && !((a) & ATTR_BANK1))
+#define REMAP_TILE(t, a)  (REMAPPED(t, a) ? remap_ids[t] : (t))
+#define REMAP_ATTR(t, a)  (REMAPPED(t, a) ? (uint8_t)((a) | remap_attrs[t]) : (a))
+
+/* Map cursor: offset of the next write and the row it writes to */
+static uint16_t cur_offset;
+static uint8_t cur_y;
+
+#ifdef RENDER_STATS
+render_stats_t render_stats;
+static uint16_t frame_mark;  /* bytes_uploaded at the last VBL handler */
+#endif
+
+/* ======== STAT-Safe VRAM Writer ======== */
+
+/* Arguments for vram_copy, passed in globals so the assembly version
+   does not depend on the compiler's calling convention */
+static uint8_t *vc_dst;
+static const uint8_t *vc_src;
+static uint8_t vc_len;
+
+#if defined(__SDCC) && !defined(RENDER_NO_ASM)
+/* Copy vc_len bytes, waiting before each one until STAT reports mode 0
+   or 1. Mode 2 follows mode 0 and VRAM stays accessible through it, so
+   the write always lands before mode 3 locks VRAM. */
+static void vram_copy(void) __naked {
+    __asm
+        ld   hl, #_vc_src
+        ld   a, (hl+)
+        ld   e, a
+        ld   d, (hl)
+        ld   hl, #_vc_len
+        ld   c, (hl)
+        ld   hl, #_vc_dst
+        ld   a, (hl+)
+        ld   h, (hl)
+        ld   l, a
+    1$:
+        ldh  a, (_STAT_REG + 0)
+        and  #0x02
+        jr   nz, 1$
+        ld   a, (de)
+        ld   (hl+), a
+        inc  de
+        dec  c
+        jr   nz, 1$
+        ret
+    __endasm;
+}
+#else
+/* Portable fallback of the routine above */
+static void vram_copy(void) {
+    uint8_t *dst = vc_dst;
+    const uint8_t *src = vc_src;
+    uint8_t n = vc_len;
+    while (n--) {
+        while (STAT_REG & STATF_BUSY);
+        *dst++ = *src++;
+    }
+}
+#endif
+
+/* ======== Upload ======== */
+
+/* General-purpose DMA of blocks x 16 bytes into the current VRAM bank */
+static void gdma(const uint8_t *src, uint16_t dst, uint8_t blocks) {
+    HDMA1_REG = (uint8_t)((uint16_t)src >> 8);
+    HDMA2_REG = (uint8_t)(uint16_t)src;
+    HDMA3_REG = (uint8_t)(dst >> 8);
+    HDMA4_REG = (uint8_t)dst;
+    HDMA5_REG = blocks - 1;  /* bit 7 clear: transfer now, CPU halted */
+#ifdef RENDER_STATS
+    render_stats.bytes_uploaded += (uint16_t)blocks << 4;
+#endif
+}
+
+/* GDMA the halves of one map row selected by bits (1 = columns 0-15,
+   2 = columns 16-31) into the current VRAM bank */
+static void gdma_halves(const uint8_t *src, uint16_t dst, uint8_t bits) {
+    if (bits == 3) {
+        gdma(src, dst, 2);
+        return;
+    }
+    if (bits == 2) {
+        src += 16;
+        dst += 16;
+    }
+    gdma(src, dst, 1);
+}
+
+/* STAT-safe CPU copy of len bytes into the current VRAM bank */
+static void cpu_copy(uint16_t dst, const uint8_t *src, uint8_t len) {
+    vc_dst = (uint8_t *)dst;
+    vc_src = src;
+    vc_len = len;
+    vram_copy();
+#ifdef RENDER_STATS
+    render_stats.bytes_uploaded += len;
+#endif
+}
+
+/* Has the time for this flush mode run out? */
+static uint8_t out_of_time(uint8_t mode) {
+    if (mode == FLUSH_VBLANK) {
+        return (uint8_t)(LY_REG - 144) >= (FLUSH_LAST_LINE - 144);
+    }
+    if (mode == FLUSH_HBLANK) {
+        return LY_REG >= stream_last_line;
+    }
+    return 0;
+}
+
+/* Any row of map m still waiting for upload? */
+static uint8_t any_dirty(uint8_t m) {
+    uint8_t y;
+    for (y = 0; y < MAP_H; y++) {
+        if (row_dirty[m][y]) return 1;
+    }
+    return 0;
+}
+
+/* CPU copy of the halves of row y of map m selected by bits, to the
+   row at dst, checking the time before each one. Halves that did not
+   fit go back into the row's dirty bits for the next flush. Returns 0
+   if the time for the flush mode ran out first. */
+static uint8_t cpu_row(uint8_t m, uint8_t y, uint16_t dst, uint8_t bits, uint8_t mode) {
+    uint16_t offset = (uint16_t)y << 5;
+    uint8_t bit;
+
+    if (!render_cgb) {
+        bits &= DIRTY_TILES;
+    }
+    for (bit = 1; bits; bit <<= 1) {
+        if (!(bits & bit)) continue;
+        if (out_of_time(mode)) {
+            row_dirty[m][y] |= bits;
+            return 0;
+        }
+        bits &= ~bit;
+
+        const uint8_t *src = (bit & DIRTY_ATTRS ? shadow_attrs[m] : shadow_tiles[m]) + offset;
+        uint8_t half = bit & 0x0A ? 16 : 0;
+        if (render_cgb) {
+            VBK_REG = bit & DIRTY_ATTRS ? 1 : 0;
+        }
+        cpu_copy(dst + offset + half, src + half, 16);
+    }
+    return 1;
+}
+
+/* Push the dirty rows of map m to VRAM, starting from row y and
+   wrapping around to the rows above it. Returns 0 if the time for the
+   flush mode ran out first. */
+static uint8_t flush_map(uint8_t m, uint8_t mode, uint8_t y) {
+    volatile uint8_t *dirty = row_dirty[m];
+    uint16_t base = MAP_BASE + (m ? MAP_BYTES : 0) + (BG_ROW0 << 5);
+    uint8_t use_dma = render_cgb && mode != FLUSH_HBLANK;
+    uint8_t left = MAP_H;
+
+    for (; left; left--, y = y == MAP_H - 1 ? 0 : y + 1) {
+        uint8_t bits = dirty[y];
+        if (!bits) continue;
+        if (out_of_time(mode)) return 0;
+
+        uint16_t offset = (uint16_t)y << 5;
+
+        if (use_dma && bits == DIRTY_ROW) {
+            /* Gather a run of fully dirty rows into one burst; a burst
+               ends at the bottom of the map */
+            uint8_t max_rows = mode == FLUSH_VBLANK ? DMA_MAX_ROWS : MAP_H;
+            uint8_t rows = 1;
+            dirty[y] = 0;
+            while (rows < left && y + rows < MAP_H &&
+                   dirty[y + rows] == DIRTY_ROW && rows < max_rows) {
+                dirty[y + rows] = 0;
+                rows++;
+            }
+#ifdef RENDER_STATS
+            render_stats.rows += rows;
+#endif
+
+            VBK_REG = 0;
+            gdma(shadow_tiles[m] + offset, base + offset, rows * 2);
+            VBK_REG = 1;
+            gdma(shadow_attrs[m] + offset, base + offset, rows * 2);
+
+            /* The loop steps past the last row of the burst */
+            y += rows - 1;
+            left -= rows - 1;
+            continue;
+        }
+
+        dirty[y] = 0;
+#ifdef RENDER_STATS
+        render_stats.rows++;
+#endif
+        if (use_dma) {
+            /* Only the halves that changed, in each bank */
+            if (bits & DIRTY_TILES) {
+                VBK_REG = 0;
+                gdma_halves(shadow_tiles[m] + offset, base + offset, bits & DIRTY_TILES);
+            }
+            if (bits & DIRTY_ATTRS) {
+                VBK_REG = 1;
+                gdma_halves(shadow_attrs[m] + offset, base + offset, bits >> 2);
+            }
+        } else if (!cpu_row(m, y, base, bits, mode)) {
+            /* CPU copies, both banks on CGB, the tile map only on DMG */
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Upload the HUD rows written since the last VBlank */
+static void flush_hud(void) {
+    uint8_t rows = hud_dirty;
+    uint8_t y;
+
+    hud_dirty = 0;
+    for (y = 0; y < HUD_H; y++, rows >>= 1) {
+        uint16_t offset = (uint16_t)y << 5;
+        if (!(rows & 1)) continue;
+        if (render_cgb) {
+            VBK_REG = 0;
+            gdma(hud_tiles + offset, HUD_BASE + offset, 2);
+            VBK_REG = 1;
+            gdma(hud_attrs + offset, HUD_BASE + offset, 2);
+        } else {
+            cpu_copy(HUD_BASE + offset, hud_tiles + offset, HUD_W);
+        }
+    }
+}
+
+/* Point the BG at map m */
+static void flip_to(uint8_t m) {
+    if (m) {
+        LCDC_REG |= LCDCF_BG9C00;
+    } else {
+        LCDC_REG &= ~LCDCF_BG9C00;
+    }
+    shown_map = m;
+}
+
+/* Upload the HUD and dirty rows, the visible map first, in FLUSH_ALL or
+   FLUSH_VBLANK mode */
+static void flush_rows(uint8_t mode) {
+    uint8_t saved_bank = render_cgb ? VBK_REG & 1 : 0;
+#ifdef RENDER_STATS
+    uint8_t start_ly = LY_REG;
+#endif
+
+    if (hud_dirty) {
+        flush_hud();
+    }
+    if (flush_map(shown_map, mode, view_row)) {
+        flush_map(shown_map ^ 1, mode, 0);
+    }
+    if (render_cgb) {
+        VBK_REG = saved_bank;
+    }
+
+#ifdef RENDER_STATS
+    if (mode == FLUSH_VBLANK) {
+        uint8_t lines = LY_REG - start_ly;
+        render_stats.last_lines = lines;
+        if (lines > render_stats.max_lines) render_stats.max_lines = lines;
+    }
+#endif
+}
+
+/* VBL handler: upload as many dirty rows as fit in this VBlank, then
+   flip to a requested map once all of it has reached VRAM */
+static void render_vbl(void) {
+    SCX_REG = scroll_x;
+    SCY_REG = BG_ROW0 * 8 + scroll_y;
+    flush_rows(FLUSH_VBLANK);
+    if (show_pending != NO_SHOW && !any_dirty(show_pending)) {
+        flip_to(show_pending);
+        show_pending = NO_SHOW;
+    }
+#ifdef RENDER_STATS
+    render_stats.frame_bytes = render_stats.bytes_uploaded - frame_mark;
+    frame_mark = render_stats.bytes_uploaded;
+#endif
+}
+
+/* LCD handler at LY == STREAM_FIRST_LINE: stream the hidden map during
+   the rest of the visible frame */
+static void render_lcd(void) {
+    uint8_t saved_bank;
+
+    /* Ignore spurious STAT interrupts (DMG raises one on STAT writes) */
+    if (LY_REG < STREAM_FIRST_LINE) return;
+
+    if (!render_cgb) {
+        flush_map(shown_map ^ 1, FLUSH_HBLANK, 0);
+        return;
+    }
+    saved_bank = VBK_REG & 1;
+    flush_map(shown_map ^ 1, FLUSH_HBLANK, 0);
+    VBK_REG = saved_bank;
+}
+
+/* ======== Drawing ======== */
+
+/* Dirty bits of the row halves that columns x to x + w - 1 touch */
+static uint8_t half_bits(uint8_t x, uint8_t w) {
+    uint8_t bits = 0;
+    if (x < 16) bits |= 1;
+    if ((uint8_t)(x + w) > 16) bits |= 2;
+    return bits;
+}
+
+void (*render_metatile)(uint8_t x, uint8_t y, const metatile_t *mt);
+
+/* Draw a metatile in one pass over both maps, comparing entry by entry
+   and marking only the row halves where something changed */
+static void metatile_cgb(uint8_t x, uint8_t y, const metatile_t *mt) {
+    uint16_t offset = ((uint16_t)y << 5) + x;
+    uint8_t *dt = tgt_tiles + offset;
+    uint8_t *da = tgt_attrs + offset;
+    const uint8_t *st = mt->tiles;
+    const uint8_t *sa = mt->attrs;
+    uint8_t w = mt->w;
+    uint8_t h = mt->h;
+
+    while (h--) {
+        uint8_t bits = 0;
+        uint8_t i;
+        for (i = 0; i < w; i++) {
+            uint8_t half = (uint8_t)(x + i) < 16 ? 1 : 2;
+            if (dt[i] != st[i]) {
+                dt[i] = st[i];
+                bits |= half;
+#ifdef RENDER_STATS
+                render_stats.bytes_changed++;
+#endif
+            }
+            if (da[i] != sa[i]) {
+                da[i] = sa[i];
+                bits |= half << 2;
+#ifdef RENDER_STATS
+                render_stats.bytes_changed++;
+#endif
+            }
+        }
+        if (bits) {
+            tgt_dirty[y] |= bits;
+        }
+        st += w;
+        sa += w;
+        dt += MAP_W;
+        da += MAP_W;
+        y++;
+    }
+}
+
+/* CGB version with tile translation: logical tile t is drawn as VRAM
+   tile remap_ids[t] with remap_attrs[t] added to its attribute */
+static void metatile_remap(uint8_t x, uint8_t y, const metatile_t *mt) {
+    uint16_t offset = ((uint16_t)y << 5) + x;
+    uint8_t *dt = tgt_tiles + offset;
+    uint8_t *da = tgt_attrs + offset;
+    const uint8_t *st = mt->tiles;
+    const uint8_t *sa = mt->attrs;
+    uint8_t w = mt->w;
+    uint8_t h = mt->h;
+
+    while (h--) {
+        uint8_t bits = 0;
+        uint8_t i;
+        for (i = 0; i < w; i++) {
+            uint8_t half = (uint8_t)(x + i) < 16 ? 1 : 2;
+            uint8_t t = REMAP_TILE(st[i], sa[i]);
+            uint8_t a = REMAP_ATTR(st[i], sa[i]);
+            if (dt[i] != t) {
+                dt[i] = t;
+                bits |= half;
+#ifdef RENDER_STATS
+                render_stats.bytes_changed++;
+#endif
+            }
+            if (da[i] != a) {
+                da[i] = a;
+                bits |= half << 2;
+#ifdef RENDER_STATS
+                render_stats.bytes_changed++;
+#endif
+            }
+        }
+        if (bits) {
+            tgt_dirty[y] |= bits;
+        }
+        st += w;
+        sa += w;
+        dt += MAP_W;
+        da += MAP_W;
+        y++;
+    }
+}
+
+/* DMG version of the above, tile map only */
+static void metatile_dmg(uint8_t x, uint8_t y, const metatile_t *mt) {
+    uint8_t *dt = tgt_tiles + ((uint16_t)y << 5) + x;
+    const uint8_t *st = mt->tiles;
+    uint8_t w = mt->w;
+    uint8_t h = mt->h;
+
+    while (h--) {
+        uint8_t bits = 0;
+        uint8_t i;
+        for (i = 0; i < w; i++) {
+            if (dt[i] != st[i]) {
+                dt[i] = st[i];
+                bits |= (uint8_t)(x + i) < 16 ? 1 : 2;
+#ifdef RENDER_STATS
+                render_stats.bytes_changed++;
+#endif
+            }
+        }
+        if (bits) {
+            tgt_dirty[y] |= bits;
+        }
+        st += w;
+        dt += MAP_W;
+        y++;
+    }
+}
+
+/* Decode an RLE stream (format in res/title.c) into the top of a shadow
+   map. Returns the number of entries written; the caller marks them. */
+static uint16_t unpack(uint8_t *dst, const uint8_t *src) {
+    uint8_t *start = dst;
+    uint8_t c;
+
+    while ((c = *src++)) {
+        if (c & 0x80) {
+            c &= 0x7F;
+            memset(dst, *src++, c);
+        } else {
+            memcpy(dst, src, c);
+            src += c;
+        }
+        dst += c;
+    }
+    return dst - start;
+}
+
+/* Mark the rows that the first n entries of the target map cover */
+static void mark_entries(uint16_t n, uint8_t bits) {
+    uint8_t rows = (uint8_t)((n + MAP_W - 1) >> 5);
+    uint8_t y;
+    for (y = 0; y < rows; y++) {
+        tgt_dirty[y] |= bits;
+    }
+}
+
+void render_tiles_rle(const uint8_t *src) {
+    uint16_t n = unpack(tgt_tiles, src);
+
+    /* Translate to VRAM tiles, adding flip and bank bits to the
+       attributes that render_attrs_rle already unpacked. The rows are
+       marked only once the whole image is translated, so an upload
+       from the VBL handler can never catch them half done. */
+    if (remap_count) {
+        uint16_t i;
+        for (i = 0; i < n; i++) {
+            uint8_t t = tgt_tiles[i];
+            uint8_t a = tgt_attrs[i];
+            tgt_tiles[i] = REMAP_TILE(t, a);
+            tgt_attrs[i] = REMAP_ATTR(t, a);
+        }
+        mark_entries(n, DIRTY_ROW);
+        return;
+    }
+    mark_entries(n, DIRTY_TILES);
+}
+
+void render_attrs_rle(const uint8_t *src) {
+    if (render_cgb) {
+        mark_entries(unpack(tgt_attrs, src), DIRTY_ATTRS);
+    }
+}
+
+/* Fill w x h entries of one shadow map with v */
+static void fill(uint8_t *dst, uint8_t w, uint8_t h, uint8_t v) {
+    if (w == MAP_W) {
+        memset(dst, v, (uint16_t)h << 5);
+        return;
+    }
+    while (h--) {
+        memset(dst, v, w);
+        dst += MAP_W;
+    }
+}
+
+void render_fill_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t tile, uint8_t attr) {
+    uint16_t offset = ((uint16_t)y << 5) + x;
+    uint8_t bits = half_bits(x, w);
+
+    if (render_cgb) {
+        fill(tgt_attrs + offset, w, h, REMAP_ATTR(tile, attr));
+        tile = REMAP_TILE(tile, attr);
+        bits |= bits << 2;
+    }
+    fill(tgt_tiles + offset, w, h, tile);
+    while (h--) {
+        tgt_dirty[y++] |= bits;
+    }
+}
+
+/* ======== Row Writers ======== */
+
+/* Write n tiles and one attribute to a row of tile and attribute shadow
+   (the attributes are left alone on DMG) */
+static void put_row(uint8_t *dt, uint8_t *da, uint8_t n, const uint8_t *tiles, uint8_t attr) {
+    if (remap_count) {
+        while (n--) {
+            uint8_t t = *tiles++;
+            *dt++ = REMAP_TILE(t, attr);
+            *da++ = REMAP_ATTR(t, attr);
+        }
+        return;
+    }
+    memcpy(dt, tiles, n);
+    if (render_cgb) {
+        memset(da, attr, n);
+    }
+}
+
+/* Write one tile and attribute n times */
+static void repeat_row(uint8_t *dt, uint8_t *da, uint8_t n, uint8_t tile, uint8_t attr) {
+    if (render_cgb) {
+        memset(da, REMAP_ATTR(tile, attr), n);
+        tile = REMAP_TILE(tile, attr);
+    }
+    memset(dt, tile, n);
+}
+
+/* ======== Map Cursor ======== */
+
+void render_locate(uint8_t x, uint8_t y) {
+    cur_y = y;
+    cur_offset = ((uint16_t)y << 5) + x;
+}
+
+void render_repeat(uint8_t n, uint8_t tile, uint8_t attr) {
+    uint8_t bits = half_bits((uint8_t)cur_offset & 31, n);
+
+    repeat_row(tgt_tiles + cur_offset, tgt_attrs + cur_offset, n, tile, attr);
+    if (render_cgb) {
+        bits |= bits << 2;
+    }
+    cur_offset += n;
+    tgt_dirty[cur_y] |= bits;
+}
+
+void render_skip(uint8_t n) {
+    cur_offset += n;
+}
+
+void render_flush(void) {
+    if (LCDC_REG & LCDCF_ON) {
+        while (hud_dirty || any_dirty(0) || any_dirty(1)) {
+            wait_vbl_done();
+        }
+    } else {
+        /* No VBlank interrupts with the LCD off, upload everything now */
+        flush_rows(FLUSH_ALL);
+    }
+}
+
+/* ======== Window HUD ======== */
+
+void render_hud_put(uint8_t x, uint8_t y, uint8_t n, const uint8_t *tiles, uint8_t attr) {
+    uint8_t offset = (y << 5) + x;
+    put_row(hud_tiles + offset, hud_attrs + offset, n, tiles, attr);
+    hud_dirty |= 1 << y;
+}
+
+void render_hud_repeat(uint8_t x, uint8_t y, uint8_t n, uint8_t tile, uint8_t attr) {
+    uint8_t offset = (y << 5) + x;
+    repeat_row(hud_tiles + offset, hud_attrs + offset, n, tile, attr);
+    hud_dirty |= 1 << y;
+}
+
+/* ======== Tile Translation ======== */
+
+void render_tile_remap(const uint8_t *ids, const uint8_t *attrs, uint8_t count) {
+    /* The DMG keeps the logical tile set in its one bank */
+    if (!render_cgb) return;
+
+    remap_ids = ids;
+    remap_attrs = attrs;
+    remap_count = count;
+    render_metatile = count ? metatile_remap : metatile_cgb;
+}
+
+/* ======== Map Selection ======== */
+
+void render_target(uint8_t map) {
+    tgt_tiles = shadow_tiles[map];
+    tgt_attrs = shadow_attrs[map];
+    tgt_dirty = row_dirty[map];
+}
+
+uint8_t render_back(void) {
+    return shown_map ^ 1;
+}
+
+void render_show(uint8_t map) {
+    if (LCDC_REG & LCDCF_ON) {
+        show_pending = map;
+        while (show_pending != NO_SHOW) {
+            wait_vbl_done();
+        }
+    } else {
+        flush_rows(FLUSH_ALL);
+        flip_to(map);
+    }
+}
+
+void render_scroll(uint8_t x, uint8_t y) {
+    scroll_x = x;
+    scroll_y = y;
+    view_row = y >> 3;
+}
+
+/* ======== Setup ======== */
+
+void render_init(void) {
+    render_cgb = (_cpu == CGB_TYPE);
+    /* main switches a CGB to double speed before this */
+    stream_last_line = render_cgb ? STREAM_LAST_LINE_CGB : STREAM_LAST_LINE_DMG;
+    render_metatile = render_cgb ? metatile_cgb : metatile_dmg;
+#ifdef RENDER_STATS
+    render_stats.cgb = render_cgb;
+#endif
+
+    shadow_tiles[0] = (uint8_t *)(((uint16_t)shadow_raw + 15) & 0xFFF0);
+    shadow_attrs[0] = shadow_tiles[0] + SHADOW_SIZE;
+    shadow_tiles[1] = shadow_attrs[0] + SHADOW_SIZE;
+    shadow_attrs[1] = shadow_tiles[1] + SHADOW_SIZE;
+    hud_tiles = shadow_attrs[1] + SHADOW_SIZE;
+    hud_attrs = hud_tiles + HUD_SIZE;
+
+    /* BG content starts below the HUD rows; the window covers the
+       bottom HUD_H rows of the screen */
+    SCY_REG = BG_ROW0 * 8;
+    WX_REG = 7;
+    WY_REG = 144 - HUD_H * 8;
+    LCDC_REG |= LCDCF_WIN9C00;
+
+    flip_to(0);
+    render_target(0);
+
+    CRITICAL {
+        add_VBL(render_vbl);
+        add_LCD(render_lcd);
+        LYC_REG = STREAM_FIRST_LINE;
+        STAT_REG = STATF_LYC;
+    }
+    set_interrupts(VBL_IFLAG | LCD_IFLAG);
+}
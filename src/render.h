@@ -0,0 +1,162 @@
+/*
+ * Shadow-map renderer for the sliding puzzle
+ *
+ * Game logic never touches the BG map directly. Tile and attribute
+ * writes go to a WRAM shadow of the target map and mark their rows
+ * dirty; a VBL handler uploads only the dirty rows, so every VRAM
+ * write lands inside the VBlank window.
+ *
+ * Both BG maps are shadowed. The next screen can be drawn into the map
+ * that is not on screen while the current one stays up, then shown
+ * with a single LCDC flip.
+ *
+ * The HUD is drawn on the Window layer across the bottom HUD_H rows of
+ * the screen, with its own shadow, so HUD updates never touch or wait
+ * behind the board maps.
+ *
+ * A map holds more than the screen shows; render_scroll picks the part
+ * in view, and the rows in view are uploaded first.
+ */
+
+#ifndef RENDER_H
+#define RENDER_H
+
+#include <stdint.h>
+
+/* Shadow map dimensions: full 32-tile map rows, every map row below the
+   HUD_H rows the window uses */
+#define MAP_W  32
+#define MAP_H  30
+
+/* BG maps: 0 = 0x9800, 1 = 0x9C00 */
+#define RENDER_MAPS  2
+
+/* Window HUD size in tiles */
+#define HUD_W  20
+#define HUD_H  2
+
+/* Map area visible above the HUD, in tiles */
+#define VIEW_W  20
+#define VIEW_H  (18 - HUD_H)
+
+/* Set up the shadow maps and install the VBL upload handler and the LYC
+   streaming handler. Map 0 is shown and targeted. */
+void render_init(void);
+
+/* A w x h block of tiles and their CGB attributes, both row-major */
+typedef struct {
+    uint8_t w;
+    uint8_t h;
+    const uint8_t *tiles;
+    const uint8_t *attrs;
+} metatile_t;
+
+/* Draw a metatile with its top-left corner at (x, y). Only entries that
+   differ from what the map already holds are uploaded, so a map must be
+   filled once before metatiles are drawn on it. render_init points this
+   at a CGB or a DMG (tiles only) version. */
+extern void (*render_metatile)(uint8_t x, uint8_t y, const metatile_t *mt);
+
+/* Replace the attribute map with an RLE-compressed image MAP_W wide
+   (format in res/title.c), from the top row down to the end of the
+   data; rows below it keep what they held. Every row goes up in
+   full-row bursts. */
+void render_attrs_rle(const uint8_t *src);
+
+/* Same for the tile map. Call it after render_attrs_rle, which would
+   otherwise overwrite the flip and bank bits of translated tiles. */
+void render_tiles_rle(const uint8_t *src);
+
+/* Fill a w x h rectangle with one tile and one attribute. Each map is
+   filled in its own pass; full-width rectangles (w == MAP_W) are one
+   contiguous memset per map. */
+void render_fill_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t tile, uint8_t attr);
+
+/* Block until every dirty row of both maps has reached VRAM */
+void render_flush(void);
+
+/* Send all following drawing to map (the cursor must be relocated) */
+void render_target(uint8_t map);
+
+/* The map that is not on screen */
+uint8_t render_back(void);
+
+/* Show map once all of its rows have been uploaded. The flip happens in
+   the VBL handler, so this blocks for as many frames as the upload
+   takes. With the LCD off it uploads and flips immediately. */
+void render_show(uint8_t map);
+
+/* Scroll both maps so the screen shows them from pixel (x, y), at most
+   ((MAP_W - VIEW_W) * 8, (MAP_H - VIEW_H) * 8). Takes effect in the next
+   VBlank, which from then on uploads the rows in view first. */
+void render_scroll(uint8_t x, uint8_t y);
+
+/* ======== Tile Translation ======== */
+
+/* CGB attribute bit that takes the tile from VRAM bank 1 */
+#define ATTR_BANK1  0x08
+
+/* All drawing calls take logical tile numbers. On CGB, once a table is
+   set, logical tile t < count goes to VRAM as tile ids[t] with attrs[t]
+   added to its attribute: flip bits, which let mirrored tiles share one
+   VRAM slot, and ATTR_BANK1 for tiles placed in bank 1. Tiles from
+   count up, and any tile drawn with ATTR_BANK1, go through unchanged.
+   A count of 0 switches translation off. Ignored on DMG, which has no
+   BG flips or second bank and loads the full logical tile set. */
+void render_tile_remap(const uint8_t *ids, const uint8_t *attrs, uint8_t count);
+
+/* ======== Map Cursor ======== */
+
+/* Sequential writer: the map address is computed once by render_locate
+   and then auto-increments. Every write sets the tile and its attribute
+   together. Runs must not cross the end of a map row. */
+
+/* Move the cursor to (x, y) */
+void render_locate(uint8_t x, uint8_t y);
+
+/* Write the same tile n times */
+void render_repeat(uint8_t n, uint8_t tile, uint8_t attr);
+
+/* Advance the cursor n entries without writing */
+void render_skip(uint8_t n);
+
+/* ======== Window HUD ======== */
+
+/* HUD rows are uploaded in the next VBlank, before any map rows, so
+   any number of writes to a row in one frame costs one upload. The
+   window is shown and hidden with SHOW_WIN / HIDE_WIN. */
+
+/* Write n tiles from tiles at HUD position (x, y), all with one attribute */
+void render_hud_put(uint8_t x, uint8_t y, uint8_t n, const uint8_t *tiles, uint8_t attr);
+
+/* Write the same tile n times from HUD position (x, y) */
+void render_hud_repeat(uint8_t x, uint8_t y, uint8_t n, uint8_t tile, uint8_t attr);
+
+/* ======== Statistics ======== */
+
+#ifdef RENDER_STATS
+/* Build with `make STATS=1` and watch _render_stats in an emulator
+   (symbols are in the .noi file). Scanlines are 114 CPU cycles in
+   single speed and 228 in CGB double speed. DMG runs take the DMG code
+   paths at single speed, so benchmark each model on its own. */
+typedef struct {
+    uint8_t cgb;              /* 1 on CGB, 0 on DMG; keep the runs apart */
+    uint8_t last_lines;       /* scanlines spent uploading in the last VBlank */
+    uint8_t max_lines;        /* worst case since boot */
+    uint16_t rows;            /* map rows uploaded since boot */
+    uint16_t bytes_changed;   /* metatile entries that differed */
+    uint16_t bytes_uploaded;  /* bytes written to VRAM, HUD included */
+    uint16_t frame_bytes;     /* map entries uploaded over the last frame,
+                                 HBlank streaming plus VBlank */
+    uint8_t tile_ticks;       /* DIV ticks (64 CPU cycles each)
+                                 to compose one number tile, worst case */
+    uint16_t load_ticks;      /* DIV ticks spent loading tile sets since
+                                 boot (src/tileset.c) */
+    uint8_t step_ticks;       /* worst single tileset_step, the per-frame
+                                 cost of streaming a set in */
+} render_stats_t;
+
+extern render_stats_t render_stats;
+#endif
+
+#endif
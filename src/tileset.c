@@ -0,0 +1,210 @@
+/*
+ * Compressed tile set loader
+ *
+ * Two stages, pulled one byte at a time. lz_next decompresses the
+ * packed stream through a 256-byte window in WRAM (back-references
+ * never read VRAM, which is locked for most of the frame). tileset_step
+ * parses the packed runs, expands each tile to 2bpp into a chunk
+ * buffer, and copies the chunk to VRAM in one call.
+ */
+
+#include <gb/gb.h>
+#include <stdint.h>
+
+#include "tileset.h"
+#include "render.h"
+
+/* ======== LZ Decoder ======== */
+
+/* Control bytes: 0x01-0x7F literal run, 0x80-0xBF repeat the next byte,
+   0xC0-0xFF copy from the window; repeat and copy counts are biased */
+#define LZ_REPEAT  0x80
+#define LZ_COPY    0xC0
+#define LZ_COUNT   0x3F
+#define LZ_MIN     3
+
+static const uint8_t *lz_src;
+static uint8_t lz_window[256];   /* the last 256 bytes of output */
+static uint8_t lz_pos;           /* where the next output byte goes */
+static uint8_t lz_left;          /* bytes left in the current control */
+static uint8_t lz_mode;          /* 0, LZ_REPEAT or LZ_COPY */
+static uint8_t lz_from;          /* repeated byte, or window position to copy */
+
+static uint8_t lz_next(void) {
+    uint8_t b;
+
+    if (!lz_left) {
+        uint8_t control = *lz_src++;
+        if (control < LZ_REPEAT) {
+            lz_mode = 0;
+            lz_left = control;
+        } else {
+            lz_mode = control & LZ_COPY;
+            lz_left = (control & LZ_COUNT) + LZ_MIN;
+            lz_from = *lz_src++;
+            if (lz_mode == LZ_COPY) {
+                lz_from = lz_pos - lz_from - 1;
+            }
+        }
+    }
+    lz_left--;
+
+    if (lz_mode == 0) {
+        b = *lz_src++;
+    } else if (lz_mode == LZ_REPEAT) {
+        b = lz_from;
+    } else {
+        b = lz_window[lz_from++];
+    }
+    lz_window[lz_pos++] = b;
+    return b;
+}
+
+/* ======== Tile Runs ======== */
+
+/* Run control byte: 0 ends the set, bit 7 set marks a 1bpp run, the
+   low bits count its tiles. A 1bpp run of no tiles is a placement: the
+   VRAM bank and first tile of the tiles that follow. */
+#define RUN_1BPP   0x80
+#define RUN_PLACE  0x80
+#define RUN_COUNT  0x7F
+
+/* Color 0 of an opaque sprite tile becomes color 1 */
+#define OPAQUE(c)  ((c) ? (c) : 1)
+
+static uint8_t ts_first;    /* next tile to upload */
+static uint8_t ts_bank;     /* CGB VRAM bank it goes to */
+static uint8_t ts_dest;     /* TILESET_BKG or TILESET_OPAQUE */
+static uint8_t ts_left;     /* tiles left in the current run */
+static uint8_t ts_1bpp;     /* the current run is 1bpp */
+static uint8_t ts_done;
+
+/* Bitplane masks of the current 1bpp run: each 2bpp plane is the row
+   where its bit of the set color is 1, plus the inverted row where its
+   bit of the clear color is 1 */
+static uint8_t ts_lo_set, ts_lo_clear, ts_hi_set, ts_hi_clear;
+
+static uint8_t ts_buf[TILESET_CHUNK * 16];
+
+void tileset_open(const uint8_t *src, uint8_t first, uint8_t dest) {
+    lz_src = src;
+    lz_pos = 0;
+    lz_left = 0;
+    ts_first = first;
+    ts_bank = 0;
+    ts_dest = dest;
+    ts_left = 0;
+    ts_done = 0;
+}
+
+/* Copy n expanded tiles from ts_buf to VRAM */
+static void upload(uint8_t n) {
+    if (!n) return;
+    if (ts_bank) VBK_REG = 1;
+    if (ts_dest == TILESET_OPAQUE) {
+        set_sprite_data(ts_first, n, ts_buf);
+    } else {
+        set_bkg_data(ts_first, n, ts_buf);
+    }
+    if (ts_bank) VBK_REG = 0;
+    ts_first += n;
+}
+
+/* Start the run with header control */
+static void start_run(uint8_t control) {
+    ts_left = control & RUN_COUNT;
+    ts_1bpp = control & RUN_1BPP;
+    if (ts_1bpp) {
+        uint8_t colors = lz_next();
+        uint8_t fg = colors >> 4;
+        uint8_t bg = colors & 0x0F;
+        if (ts_dest == TILESET_OPAQUE) {
+            fg = OPAQUE(fg);
+            bg = OPAQUE(bg);
+        }
+        ts_lo_set = (fg & 1) ? 0xFF : 0x00;
+        ts_hi_set = (fg & 2) ? 0xFF : 0x00;
+        ts_lo_clear = (bg & 1) ? 0xFF : 0x00;
+        ts_hi_clear = (bg & 2) ? 0xFF : 0x00;
+    }
+}
+
+uint8_t tileset_step(void) {
+    uint8_t *dst = ts_buf;
+    uint8_t n = 0;
+    uint8_t i;
+#ifdef RENDER_STATS
+    uint8_t start = DIV_REG;
+    uint8_t ticks;
+#endif
+
+    while (n < TILESET_CHUNK && !ts_done) {
+        if (!ts_left) {
+            uint8_t control = lz_next();
+            if (!control) {
+                ts_done = 1;
+                break;
+            }
+            if (control == RUN_PLACE) {
+                /* Tiles already in the chunk belong to the old place:
+                   they end this step's upload */
+                upload(n);
+                ts_bank = lz_next();
+                ts_first = lz_next();
+                if (n) {
+                    n = 0;
+                    break;
+                }
+                continue;
+            }
+            start_run(control);
+        }
+        if (ts_1bpp) {
+            for (i = 0; i < 8; i++) {
+                uint8_t row = lz_next();
+                uint8_t inv = ~row;
+                *dst++ = (row & ts_lo_set) | (inv & ts_lo_clear);
+                *dst++ = (row & ts_hi_set) | (inv & ts_hi_clear);
+            }
+        } else {
+            for (i = 0; i < 8; i++) {
+                uint8_t lo = lz_next();
+                uint8_t hi = lz_next();
+                /* Color 0 has both bitplanes clear: set its low bit */
+                if (ts_dest == TILESET_OPAQUE) {
+                    lo |= (uint8_t)~(lo | hi);
+                }
+                *dst++ = lo;
+                *dst++ = hi;
+            }
+        }
+        ts_left--;
+        n++;
+    }
+
+    upload(n);
+
+#ifdef RENDER_STATS
+    ticks = DIV_REG - start;
+    render_stats.load_ticks += ticks;
+    if (ticks > render_stats.step_ticks) render_stats.step_ticks = ticks;
+#endif
+    return !ts_done;
+}
+
+/* Stream a whole set; with the display on, one chunk per frame right
+   after VBlank starts */
+static void load(const uint8_t *src, uint8_t first, uint8_t dest) {
+    tileset_open(src, first, dest);
+    do {
+        if (LCDC_REG & LCDCF_ON) wait_vbl_done();
+    } while (tileset_step());
+}
+
+void tileset_load_bkg(uint8_t first, const uint8_t *src) {
+    load(src, first, TILESET_BKG);
+}
+
+void tileset_load_opaque(uint8_t first, const uint8_t *src) {
+    load(src, first, TILESET_OPAQUE);
+}
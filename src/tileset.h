@@ -0,0 +1,49 @@
+/*
+ * Compressed tile set loader
+ *
+ * Tile sets are converted from PNG sheets by tools/png2tiles.py. Tiles
+ * are packed in runs of 1bpp tiles (two colors or fewer, 8 bytes each
+ * plus one color byte per run) and 2bpp tiles (16 bytes each), and the
+ * packed stream is LZ/RLE compressed (formats in tools/tileset.py).
+ *
+ * Sets are decompressed and expanded to 2bpp a chunk of tiles at a
+ * time, so a set can be streamed in while the display is on without
+ * any one frame's upload growing with the size of the set.
+ *
+ * CGB sets written by tools/dedup_tiles.py carry their own placement:
+ * the VRAM bank and tile each part of the set goes to, fixed at build
+ * time by the CGB VRAM layout in the Makefile.
+ */
+
+#ifndef TILESET_H
+#define TILESET_H
+
+#include <stdint.h>
+
+/* Tiles expanded and uploaded per tileset_step */
+#define TILESET_CHUNK  4
+
+/* Destinations for tileset_open */
+#define TILESET_BKG     0   /* BG tile data */
+#define TILESET_OPAQUE  1   /* Sprite tile data, with color 0 (transparent
+                               in sprites) drawn as color 1 instead so
+                               every pixel is opaque */
+
+/* Start streaming a compressed set into tile data from tile first in
+   VRAM bank 0, or wherever the set's own placements put it. Only one
+   set streams at a time. */
+void tileset_open(const uint8_t *src, uint8_t first, uint8_t dest);
+
+/* Upload the next chunk of up to TILESET_CHUNK tiles. Returns 0 once the
+   whole set is in VRAM. The copy is STAT-checked, so it is safe with the
+   display on; call it right after VBlank starts to keep it inside. */
+uint8_t tileset_step(void);
+
+/* Load a whole set into BG tile data from tile first. With the display
+   on this takes one frame per chunk. */
+void tileset_load_bkg(uint8_t first, const uint8_t *src);
+
+/* Same into sprite tile data, drawn opaque (see TILESET_OPAQUE) */
+void tileset_load_opaque(uint8_t first, const uint8_t *src);
+
+#endif
@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+"""Deduplicate a puzzle tile set under X/Y flip for the CGB.
+
+Reads the compressed set prefix_tiles[] written by tools/png2tiles.py
+and writes:
+
+  prefix_tiles_cgb[]      the unique tiles, in first-seen order,
+                          compressed the same way (see tools/tileset.py)
+                          with placements that put each in its slot
+  PREFIX_TILES_CGB_COUNT  how many there are
+  prefix_tile_ids[]       logical tile -> CGB VRAM tile
+  prefix_tile_attrs[]     logical tile -> BG attribute bits that turn
+                          the VRAM tile back into the logical one: the
+                          flips (0x20 = X flip, 0x40 = Y flip) and the
+                          VRAM bank (0x08 = bank 1)
+
+Unique tiles fill the slots given as bank:first-last ranges, in order,
+so a set that outgrows bank 0 carries on in bank 1. The Makefile holds
+the CGB VRAM layout these come from.
+
+Game code and map data keep using logical tile numbers; the renderer
+translates them on CGB. The DMG cannot flip BG tiles and still loads the
+full logical set.
+
+Usage: dedup_tiles.py [res/tiles.c] [res/tiles_cgb.c] [prefix] [slots...]
+"""
+
+import sys
+
+import tileset
+
+ATTR_BANK1 = 0x08
+ATTR_FLIP_X = 0x20
+ATTR_FLIP_Y = 0x40
+
+# Bank 0 only, BG tiles 0-127 (0x9000 - 0x97FF)
+DEFAULT_SLOTS = ["0:0-127"]
+
+
+def read_tiles(path, prefix):
+    """Return the tiles of prefix_tiles[] in path, expanded to 2bpp."""
+    return tileset.read_set(path, prefix + "_tiles")
+
+
+def reverse_bits(b):
+    return int("{:08b}".format(b)[::-1], 2)
+
+
+def flip_x(tile):
+    return tuple(reverse_bits(b) for b in tile)
+
+
+def flip_y(tile):
+    rows = [tile[i:i + 2] for i in range(0, 16, 2)]
+    return tuple(b for row in reversed(rows) for b in row)
+
+
+def dedup(tiles):
+    """Map every tile onto a unique tile plus the flips that restore it."""
+    unique = []
+    index = {}      # tile bytes -> (unique id, flip bits)
+    ids = []
+    flips = []
+    for tile in tiles:
+        if tile not in index:
+            uid = len(unique)
+            unique.append(tile)
+            # A tile drawn with flip f shows f(tile), so every flipped
+            # form of this tile can be drawn from it with that flip
+            variants = (
+                (tile, 0),
+                (flip_x(tile), ATTR_FLIP_X),
+                (flip_y(tile), ATTR_FLIP_Y),
+                (flip_x(flip_y(tile)), ATTR_FLIP_X | ATTR_FLIP_Y),
+            )
+            for form, bits in variants:
+                index.setdefault(form, (uid, bits))
+        uid, bits = index[tile]
+        ids.append(uid)
+        flips.append(bits)
+    return unique, ids, flips
+
+
+def parse_slots(specs):
+    """Expand bank:first-last ranges into a list of (bank, tile)."""
+    slots = []
+    for spec in specs:
+        try:
+            bank, span = spec.split(":")
+            first, last = span.split("-")
+            bank, first, last = int(bank), int(first, 0), int(last, 0)
+        except ValueError:
+            sys.exit("bad slot range %r, expected bank:first-last" % spec)
+        if bank not in (0, 1) or not 0 <= first <= last <= 255:
+            sys.exit("slot range %r is outside CGB VRAM" % spec)
+        slots += [(bank, t) for t in range(first, last + 1)]
+    return slots
+
+
+def place(unique, ids, flips, slots):
+    """Put unique tile i in slots[i]. Returns the VRAM ids, the attribute
+    bits, and the placements for tileset.pack."""
+    if len(unique) > len(slots):
+        sys.exit("%d unique tiles, only %d VRAM slots" % (len(unique), len(slots)))
+    places = []
+    for i, (bank, tile) in enumerate(slots[:len(unique)]):
+        if not places or slots[i - 1] != (bank, tile - 1):
+            places.append((i, bank, tile))
+    vram = [slots[u][1] for u in ids]
+    attrs = [bits | (ATTR_BANK1 if slots[u][0] else 0) for u, bits in zip(ids, flips)]
+    return vram, attrs, places
+
+
+def counts(places, total):
+    """Tiles in each placement"""
+    ends = [p[0] for p in places[1:]] + [total]
+    return [end - p[0] for p, end in zip(places, ends)]
+
+
+def c_rows(values, per_line, fmt):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt % v for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def write_c(path, src_name, prefix, unique, ids, attrs, places):
+    out = []
+    out.append("/*")
+    out.append(" * CGB tile set, deduplicated under X/Y flip")
+    out.append(" *")
+    out.append(" * Generated by tools/dedup_tiles.py from %s - do not edit." % src_name)
+    data = tileset.compress(tileset.pack(unique, places))
+    check = []
+    if tileset.unpack(tileset.decompress(data), path, check) != unique or check != places:
+        sys.exit("%s: compression round trip failed" % path)
+    out.append(" * %d logical tiles, %d unique tiles in VRAM, %d bytes compressed." % (
+        len(ids), len(unique), len(data)))
+    out.append(" * VRAM: %s." % ", ".join(
+        "bank %d tiles %d-%d" % (bank, first, first + count - 1)
+        for (start, bank, first), count in zip(places, counts(places, len(unique)))))
+    out.append(" */")
+    out.append("")
+    out.append("#include <gb/gb.h>")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append("const uint8_t %s_tiles_cgb[] = {" % prefix)
+    out += tileset.c_bytes(data)
+    out.append("};")
+    out.append("")
+    out.append("const uint8_t %s_TILES_CGB_COUNT = %d;" % (prefix.upper(), len(unique)))
+    out.append("")
+    out.append("/* Logical tile -> CGB VRAM tile */")
+    out.append("const uint8_t %s_tile_ids[%d] = {" % (prefix, len(ids)))
+    out.append(c_rows(ids, 10, "%2d"))
+    out.append("};")
+    out.append("")
+    out.append("/* Logical tile -> BG attribute bits (0x20 X flip, 0x40 Y flip, 0x08 bank 1) */")
+    out.append("const uint8_t %s_tile_attrs[%d] = {" % (prefix, len(attrs)))
+    out.append(c_rows(attrs, 10, "0x%02X"))
+    out.append("};")
+    out.append("")
+    open(path, "w").write("\n".join(out))
+
+
+def main():
+    src = sys.argv[1] if len(sys.argv) > 1 else "res/tiles.c"
+    dst = sys.argv[2] if len(sys.argv) > 2 else "res/tiles_cgb.c"
+    prefix = sys.argv[3] if len(sys.argv) > 3 else "puzzle"
+    slots = parse_slots(sys.argv[4:] or DEFAULT_SLOTS)
+    tiles = read_tiles(src, prefix)
+    unique, ids, flips = dedup(tiles)
+    vram, attrs, places = place(unique, ids, flips, slots)
+    write_c(dst, src, prefix, unique, vram, attrs, places)
+    print("%s: %d tiles -> %d unique" % (dst, len(tiles), len(unique)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,130 @@
+"""Minimal PNG reader for the tile tools (standard library only).
+
+Reads non-interlaced grayscale, gray+alpha, RGB, RGBA and palette images
+at any bit depth PNG allows for them, and returns every pixel as one of
+the four Game Boy shades: 0 = white, 1 = light gray, 2 = dark gray,
+3 = black, picked by nearest luminance. Transparent pixels read as
+shade 0.
+"""
+
+import struct
+import sys
+import zlib
+
+SIGNATURE = b"\x89PNG\r\n\x1a\n"
+
+# Samples per pixel for each color type
+CHANNELS = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}
+
+
+def read_chunks(data, path):
+    if data[:8] != SIGNATURE:
+        sys.exit("%s: not a PNG file" % path)
+    pos = 8
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        yield kind, data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def unfilter(raw, height, stride, bpp):
+    """Undo the per-row filters; bpp is bytes per pixel, at least 1."""
+    rows = []
+    prev = bytearray(stride)
+    pos = 0
+    for _ in range(height):
+        kind = raw[pos]
+        row = bytearray(raw[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+        for i in range(stride):
+            a = row[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if kind == 1:
+                row[i] = (row[i] + a) & 0xFF
+            elif kind == 2:
+                row[i] = (row[i] + b) & 0xFF
+            elif kind == 3:
+                row[i] = (row[i] + ((a + b) >> 1)) & 0xFF
+            elif kind == 4:
+                row[i] = (row[i] + paeth(a, b, c)) & 0xFF
+        rows.append(row)
+        prev = row
+    return rows
+
+
+def samples(row, width, channels, depth):
+    """Split a row into per-pixel sample tuples, scaled to 0-255 except
+    for palette indices."""
+    count = width * channels
+    if depth == 8:
+        vals = list(row[:count])
+    elif depth == 16:
+        vals = [row[i * 2] for i in range(count)]
+    else:
+        per = 8 // depth
+        mask = (1 << depth) - 1
+        vals = [(row[i // per] >> (8 - depth * (i % per + 1))) & mask for i in range(count)]
+    return [tuple(vals[i:i + channels]) for i in range(0, count, channels)]
+
+
+def shade(r, g, b, a=255):
+    if a < 128:
+        return 0
+    lum = (r * 299 + g * 587 + b * 114) // 1000
+    return min(3, (255 - lum + 42) // 85)
+
+
+def read_png(path):
+    """Return (width, height, rows), rows being lists of shades 0-3."""
+    data = open(path, "rb").read()
+    header = None
+    palette = []
+    alpha = []
+    idat = b""
+    for kind, body in read_chunks(data, path):
+        if kind == b"IHDR":
+            header = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"tRNS":
+            alpha = list(body)
+        elif kind == b"IDAT":
+            idat += body
+    if header is None:
+        sys.exit("%s: no IHDR chunk" % path)
+    width, height, depth, color, _, _, interlace = header
+    if color not in CHANNELS:
+        sys.exit("%s: unknown color type %d" % (path, color))
+    if interlace:
+        sys.exit("%s: interlaced PNGs are not supported" % path)
+
+    channels = CHANNELS[color]
+    stride = (width * channels * depth + 7) // 8
+    bpp = max(1, channels * depth // 8)
+    rows = unfilter(zlib.decompress(idat), height, stride, bpp)
+
+    scale = 255 // ((1 << depth) - 1) if depth < 8 else 1
+    out = []
+    for row in rows:
+        line = []
+        for px in samples(row, width, channels, depth):
+            if color == 3:
+                a = alpha[px[0]] if px[0] < len(alpha) else 255
+                line.append(shade(*palette[px[0]], a))
+            elif color == 0:
+                line.append(shade(px[0] * scale, px[0] * scale, px[0] * scale))
+            elif color == 4:
+                line.append(shade(px[0], px[0], px[0], px[1]))
+            else:
+                line.append(shade(*px))
+        out.append(line)
+    return width, height, out
@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""Convert a 96x96 PNG into the tiles of the picture puzzle (CGB).
+
+The image is cut into the 4x4 grid of 3x3-tile cells. Cells 1-15 are
+the cells in reading order; the bottom-right one is the hole and is
+dropped, leaving 135 tiles, cell n's nine at 9 (n - 1) onward in
+row-major order. Two copies are written to a ROM bank, uncompressed so
+they can go to VRAM by DMA:
+
+  picture_tiles[]    BG tiles
+  picture_sprites[]  opaque copies for the sliding sprites
+
+Sprites have no color 0: the slide sprite palettes (see init_slide in
+src/main.c) show colors 1-3 as the cell's colors 0, 2 and 3, and have
+no room for color 1, the dark number color. So the picture is drawn in
+those three colors only, and a cell looks the same sliding as at rest:
+white and light gray become colors 0 and 2, dark gray and black both
+become color 3.
+
+Usage: png2picture.py picture.png out.c bank
+"""
+
+import sys
+
+import png
+import tileset
+
+GRID = 4
+CELL = 3
+CELLS = GRID * GRID - 1
+
+# Shade -> BG palette color, and BG color -> slide sprite color (the
+# picture never uses BG color 1)
+BG_COLOR = (0, 2, 3, 3)
+SPRITE_COLOR = (1, 3, 2, 3)
+
+
+def tile_at(rows, tx, ty, colors):
+    tile = []
+    for y in range(ty * 8, ty * 8 + 8):
+        lo = hi = 0
+        for x in range(tx * 8, tx * 8 + 8):
+            c = colors[BG_COLOR[rows[y][x]]]
+            lo = lo << 1 | (c & 1)
+            hi = hi << 1 | (c >> 1)
+        tile += [lo, hi]
+    return tile
+
+
+def cut_cells(rows, colors):
+    tiles = []
+    for n in range(CELLS):
+        cy, cx = divmod(n, GRID)
+        for r in range(CELL):
+            for c in range(CELL):
+                tiles.append(tile_at(rows, cx * CELL + c, cy * CELL + r, colors))
+    return tiles
+
+
+def array(out, name, tiles):
+    out.append("const uint8_t %s[%d] = {" % (name, len(tiles) * 16))
+    for n in range(CELLS):
+        out.append("    /* Cell %d */" % (n + 1))
+        for tile in tiles[n * CELL * CELL:(n + 1) * CELL * CELL]:
+            out += tileset.c_bytes(tile, 16)
+    out.append("};")
+
+
+def main():
+    if len(sys.argv) != 4:
+        sys.exit(__doc__.strip().splitlines()[-1])
+    src, dst, bank = sys.argv[1:]
+    width, height, rows = png.read_png(src)
+    size = GRID * CELL * 8
+    if (width, height) != (size, size):
+        sys.exit("%s: must be %dx%d, not %dx%d" % (src, size, size, width, height))
+
+    out = []
+    out.append("/*")
+    out.append(" * Picture puzzle tiles")
+    out.append(" *")
+    out.append(" * Generated by tools/png2picture.py from %s - do not edit." % src)
+    out.append(" * Cell n (1-15) is tiles 9 (n - 1) to 9 (n - 1) + 8, row-major.")
+    out.append(" */")
+    out.append("")
+    out.append("#pragma bank %s" % bank)
+    out.append("")
+    out.append("#include <gb/gb.h>")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append("BANKREF(picture_tiles)")
+    out.append("")
+    array(out, "picture_tiles", cut_cells(rows, (0, 1, 2, 3)))
+    out.append("")
+    array(out, "picture_sprites", cut_cells(rows, SPRITE_COLOR))
+    out.append("")
+    open(dst, "w").write("\n".join(out))
+    print("%s: %d tiles" % (dst, CELLS * CELL * CELL))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+"""Convert a PNG tile sheet into a compressed tile set.
+
+The sheet is cut into 8x8 tiles, left to right and top to bottom, and
+its colors are reduced to the four Game Boy shades (see tools/png.py).
+The tiles are packed (1bpp where two colors do, see tools/tileset.py),
+compressed, and written as C:
+
+  name[]        the compressed set, loaded by src/tileset.c
+  NAME_COUNT    how many tiles it holds
+
+Usage: png2tiles.py sheet.png out.c name
+"""
+
+import sys
+
+import png
+import tileset
+
+
+def cut_tiles(width, height, rows, path):
+    if width % 8 or height % 8:
+        sys.exit("%s: %dx%d is not a whole number of tiles" % (path, width, height))
+    tiles = []
+    for ty in range(0, height, 8):
+        for tx in range(0, width, 8):
+            tile = []
+            for y in range(ty, ty + 8):
+                lo = hi = 0
+                for x in range(tx, tx + 8):
+                    lo = lo << 1 | (rows[y][x] & 1)
+                    hi = hi << 1 | (rows[y][x] >> 1)
+                tile += [lo, hi]
+            tiles.append(tuple(tile))
+    return tiles
+
+
+def write_c(path, src_name, name, tiles, packed, data):
+    out = []
+    out.append("/*")
+    out.append(" * Compressed tile set")
+    out.append(" *")
+    out.append(" * Generated by tools/png2tiles.py from %s - do not edit." % src_name)
+    out.append(" * %d tiles: %d bytes as 2bpp, %d packed, %d compressed." % (
+        len(tiles), len(tiles) * 16, len(packed), len(data)))
+    out.append(" */")
+    out.append("")
+    out.append("#include <gb/gb.h>")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append("const uint8_t %s[] = {" % name)
+    out += tileset.c_bytes(data)
+    out.append("};")
+    out.append("")
+    out.append("const uint8_t %s_COUNT = %d;" % (name.upper(), len(tiles)))
+    out.append("")
+    open(path, "w").write("\n".join(out))
+
+
+def main():
+    if len(sys.argv) != 4:
+        sys.exit(__doc__.strip().splitlines()[-1])
+    src, dst, name = sys.argv[1:]
+    tiles = cut_tiles(*png.read_png(src), src)
+    packed = tileset.pack(tiles)
+    data = tileset.compress(packed)
+    if tileset.unpack(tileset.decompress(data)) != tiles:
+        sys.exit("%s: compression round trip failed" % src)
+    write_c(dst, src, name, tiles, packed, data)
+    print("%s: %d tiles, %d bytes compressed" % (dst, len(tiles), len(data)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,248 @@
+"""Packed tile set format shared by the tile tools.
+
+A packed set is a stream of runs (the loader is src/tileset.c):
+
+  0x00          end of set
+  0x01 - 0x7F   that many 2bpp tiles follow, 16 bytes each
+  0x80          placement: the following tiles go to CGB VRAM bank (next
+                byte) from tile (the byte after); sets without one load
+                where the caller asks, in the current bank
+  0x81 - 0xFF   (control & 0x7F) 1bpp tiles follow: one color byte, set
+                pixels' color in the high nibble and clear pixels' in
+                the low nibble, then 8 bytes per tile, one per row
+
+The packed set is then compressed with a small LZ/RLE variant whose
+decoder needs only a 256-byte window:
+
+  0x01 - 0x7F   that many literal bytes follow
+  0x80 - 0xBF   the next byte, repeated (control & 0x3F) + 3 times
+  0xC0 - 0xFF   (control & 0x3F) + 3 bytes copied from earlier output,
+                starting (next byte) + 1 bytes back
+
+There is no end code: the packed set ends itself.
+
+Tiles are handled here as 16-byte 2bpp tuples, as VRAM stores them.
+"""
+
+import re
+import sys
+
+RUN_1BPP = 0x80
+RUN_PLACE = 0x80
+RUN_MAX = 0x7F
+
+LZ_LITERAL_MAX = 0x7F
+LZ_REPEAT = 0x80
+LZ_COPY = 0xC0
+LZ_MIN = 3
+LZ_MAX = 0x3F + LZ_MIN
+LZ_WINDOW = 256
+
+
+def read_array(path, name):
+    """Return the bytes of the C array name[] in path."""
+    text = open(path).read()
+    m = re.search(r"\b%s\[\d*\]\s*=\s*\{(.*?)\};" % re.escape(name), text, re.S)
+    if not m:
+        sys.exit("%s: no array %s[]" % (path, name))
+    body = re.sub(r"/\*.*?\*/", "", m.group(1), flags=re.S)
+    return [int(v, 0) for v in re.findall(r"0x[0-9A-Fa-f]+|\d+", body)]
+
+
+def unpack(data, where="tile set", places=None):
+    """Expand a packed set into a list of 2bpp tiles. Placements are
+    appended to places, if given, as (tile index, bank, first)."""
+    tiles = []
+    i = 0
+    while True:
+        if i >= len(data):
+            sys.exit("%s: missing end byte" % where)
+        control = data[i]
+        i += 1
+        if control == 0:
+            break
+        if control == RUN_PLACE:
+            if places is not None:
+                places.append((len(tiles), data[i], data[i + 1]))
+            i += 2
+            continue
+        n = control & RUN_MAX
+        if control & RUN_1BPP:
+            fg, bg = data[i] >> 4, data[i] & 0x0F
+            i += 1
+            for _ in range(n):
+                tiles.append(expand_1bpp(data[i:i + 8], fg, bg))
+                i += 8
+        else:
+            for _ in range(n):
+                tiles.append(tuple(data[i:i + 16]))
+                i += 16
+    if i != len(data):
+        sys.exit("%s: %d bytes after the end byte" % (where, len(data) - i))
+    return tiles
+
+
+def expand_1bpp(rows, fg, bg):
+    """The 2bpp form of a 1bpp tile, as set_bkg_1bpp_data loads it."""
+    out = []
+    for row in rows:
+        lo = hi = 0
+        for bit in range(8):
+            color = fg if row & (0x80 >> bit) else bg
+            if color & 1:
+                lo |= 0x80 >> bit
+            if color & 2:
+                hi |= 0x80 >> bit
+        out += [lo, hi]
+    return tuple(out)
+
+
+def colors(tile):
+    """The set of colors a 2bpp tile uses."""
+    used = set()
+    for r in range(0, 16, 2):
+        lo, hi = tile[r], tile[r + 1]
+        for bit in range(8):
+            used.add(((hi >> bit) & 1) << 1 | ((lo >> bit) & 1))
+    return used
+
+
+def to_1bpp(tile, fg, bg):
+    """Rows of a tile with at most two colors, set where the color is fg
+    (all clear for a single-color tile)."""
+    rows = []
+    for r in range(0, 16, 2):
+        lo, hi = tile[r], tile[r + 1]
+        row = 0
+        for bit in range(8):
+            color = ((hi >> bit) & 1) << 1 | ((lo >> bit) & 1)
+            if color == fg and color != bg:
+                row |= 1 << bit
+        rows.append(row)
+    return rows
+
+
+def runs(tiles):
+    """Split tiles into runs: a list of (colors, first, count), colors
+    being (fg, bg) for a 1bpp run and None for a 2bpp run. Consecutive
+    tiles share a 1bpp run while their colors fit in one pair."""
+    out = []
+    for i, tile in enumerate(tiles):
+        used = colors(tile)
+        if out:
+            pair, first, count = out[-1]
+            prev = None if pair is None else set(pair)
+            if count < RUN_MAX and (
+                    (prev is None and len(used) > 2) or
+                    (prev is not None and len(used) <= 2 and len(prev | used) <= 2)):
+                out[-1] = (None if prev is None else pair_of(prev | used), first, count + 1)
+                continue
+        out.append((None if len(used) > 2 else pair_of(used), i, 1))
+    return out
+
+
+def pair_of(used):
+    """(fg, bg) for a set of one or two colors: the darker one is fg."""
+    return (max(used), min(used))
+
+
+def pack_runs(tiles):
+    """The packed runs for tiles, without an end byte."""
+    out = []
+    for pair, first, count in runs(tiles):
+        if pair is None:
+            out.append(count)
+            for tile in tiles[first:first + count]:
+                out += tile
+        else:
+            out += [RUN_1BPP | count, pair[0] << 4 | pair[1]]
+            for tile in tiles[first:first + count]:
+                out += to_1bpp(tile, pair[0], pair[1])
+    return out
+
+
+def pack(tiles, places=()):
+    """The packed byte stream for tiles. places is a list of
+    (tile index, bank, first) placements in index order, the first one
+    at index 0; runs never cross a placement."""
+    if not places:
+        return pack_runs(tiles) + [0]
+    out = []
+    ends = [p[0] for p in places[1:]] + [len(tiles)]
+    for (start, bank, first), end in zip(places, ends):
+        out += [RUN_PLACE, bank, first] + pack_runs(tiles[start:end])
+    out.append(0)
+    return out
+
+
+def compress(data):
+    """Greedy LZ/RLE compression of a byte list."""
+    out = []
+    literals = []
+
+    def flush():
+        while literals:
+            chunk = literals[:LZ_LITERAL_MAX]
+            del literals[:LZ_LITERAL_MAX]
+            out.append(len(chunk))
+            out.extend(chunk)
+
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < LZ_MAX and data[i + run] == data[i]:
+            run += 1
+        best, back = 0, 0
+        for start in range(max(0, i - LZ_WINDOW), i):
+            n = 0
+            while i + n < len(data) and n < LZ_MAX and data[start + n] == data[i + n]:
+                n += 1
+            if n > best:
+                best, back = n, i - start
+        if run >= LZ_MIN and run >= best:
+            flush()
+            out += [LZ_REPEAT | (run - LZ_MIN), data[i]]
+            i += run
+        elif best >= LZ_MIN:
+            flush()
+            out += [LZ_COPY | (best - LZ_MIN), back - 1]
+            i += best
+        else:
+            literals.append(data[i])
+            i += 1
+    flush()
+    return out
+
+
+def decompress(data):
+    """Inverse of compress."""
+    out = []
+    i = 0
+    while i < len(data):
+        control = data[i]
+        i += 1
+        if control == 0:
+            sys.exit("compressed data: unexpected 0x00 control byte")
+        if control < LZ_REPEAT:
+            out += data[i:i + control]
+            i += control
+        elif control < LZ_COPY:
+            out += [data[i]] * ((control & 0x3F) + LZ_MIN)
+            i += 1
+        else:
+            start = len(out) - data[i] - 1
+            i += 1
+            for n in range((control & 0x3F) + LZ_MIN):
+                out.append(out[start + n])
+    return out
+
+
+def read_set(path, name):
+    """Read the compressed set name[] in path, as a list of 2bpp tiles."""
+    return unpack(decompress(read_array(path, name)), path)
+
+
+def c_bytes(data, per_line=12):
+    """C initializer lines for a byte list."""
+    return ["    " + ", ".join("0x%02X" % b for b in data[i:i + per_line]) + ","
+            for i in range(0, len(data), per_line)]